@@ -0,0 +1,303 @@
+#include <vitasdkkern.h>
+#include <taihen.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "oc.h"
+#include "perf.h"
+#include "profile.h"
+#include "autotune.h"
+
+SceUInt32 ksceKernelGetProcessTimeLowCore();
+
+#define SECOND 1000000
+
+typedef struct {
+    psvs_oc_device_t device;
+    int floor; // MHz, lowest swept clock
+} psvs_autotune_sweep_t;
+
+// Swept clocks come from the oc tables, their low end can't run games anyway
+static const psvs_autotune_sweep_t g_autotune_sweep[PSVS_AUTOTUNE_DEVICE_N] = {
+    {PSVS_OC_DEVICE_CPU,      222},
+    {PSVS_OC_DEVICE_GPU_ES4,  111},
+    {PSVS_OC_DEVICE_BUS,      166},
+    {PSVS_OC_DEVICE_GPU_XBAR, 111},
+};
+
+static psvs_autotune_state_t g_autotune_state = PSVS_AUTOTUNE_STATE_IDLE;
+static psvs_autotune_point_t g_autotune_points[PSVS_AUTOTUNE_POINT_MAX];
+static int g_autotune_point_n = 0;
+static int g_autotune_point = 0; // being measured
+static bool g_autotune_measuring = false;
+static SceUInt32 g_autotune_tick_start = 0;
+static uint32_t g_autotune_frame_last = 0;
+static uint32_t g_autotune_frames = 0;
+static psvs_frametime_hist_t g_autotune_hist;
+
+static SceUID g_autotune_pid = INVALID_PID;
+static psvs_oc_profile_t g_autotune_profile; // restored on cancel
+static bool g_autotune_profile_changed = false;
+
+bool psvs_autotune_is_running() {
+    return g_autotune_state == PSVS_AUTOTUNE_STATE_RUNNING;
+}
+
+psvs_autotune_state_t psvs_autotune_get_state() {
+    return g_autotune_state;
+}
+
+void psvs_autotune_get_progress(int *done, int *total) {
+    *done = g_autotune_point;
+    *total = g_autotune_point_n;
+}
+
+// Swept part of the device's clock table, from its floor up
+static const int *_psvs_autotune_get_freqs(int i, int *freq_n) {
+    const int *freq = psvs_oc_get_freq_table(g_autotune_sweep[i].device, freq_n);
+    while (*freq_n > 1 && *freq < g_autotune_sweep[i].floor) {
+        freq++;
+        (*freq_n)--;
+    }
+    return freq;
+}
+
+static int _psvs_autotune_get_point_n() {
+    int point_n = 1;
+    for (int i = 0; i < PSVS_AUTOTUNE_DEVICE_N; i++) {
+        int freq_n;
+        _psvs_autotune_get_freqs(i, &freq_n);
+        point_n *= freq_n;
+    }
+    return point_n;
+}
+
+// Mixed radix, CPU changes fastest
+static void _psvs_autotune_get_point(int point, int freq[PSVS_OC_DEVICE_MAX]) {
+    memset(freq, 0, sizeof(int) * PSVS_OC_DEVICE_MAX);
+    for (int i = 0; i < PSVS_AUTOTUNE_DEVICE_N; i++) {
+        int freq_n;
+        const int *sweep_freq = _psvs_autotune_get_freqs(i, &freq_n);
+        freq[g_autotune_sweep[i].device] = sweep_freq[point % freq_n];
+        point /= freq_n;
+    }
+}
+
+static void _psvs_autotune_apply(int point) {
+    // All devices in one ordered transition
+    int freq[PSVS_OC_DEVICE_MAX];
+    _psvs_autotune_get_point(point, freq);
+    psvs_oc_set_manual_freqs(freq);
+
+    g_autotune_measuring = false;
+    g_autotune_tick_start = ksceKernelGetProcessTimeLowCore();
+}
+
+static void _psvs_autotune_restore() {
+    psvs_oc_set_profile(&g_autotune_profile, NULL);
+    psvs_oc_set_changed(g_autotune_profile_changed);
+}
+
+static void _psvs_autotune_start() {
+    if (g_pid == INVALID_PID)
+        return; // nothing to tune in SceShell
+
+    g_autotune_point_n = _psvs_autotune_get_point_n();
+    if (g_autotune_point_n > PSVS_AUTOTUNE_POINT_MAX)
+        return; // floors too low for the points table
+
+    memcpy(&g_autotune_profile, psvs_oc_get_profile(), sizeof(psvs_oc_profile_t));
+    g_autotune_profile_changed = psvs_oc_has_changed();
+    g_autotune_pid = g_pid;
+    g_autotune_point = 0;
+    memset(g_autotune_points, 0, sizeof(g_autotune_points));
+
+    // Tuned devices go manual at the first point, in one transition
+    int freq[PSVS_OC_DEVICE_MAX];
+    psvs_oc_profile_t profile;
+    memcpy(&profile, &g_autotune_profile, sizeof(psvs_oc_profile_t));
+    _psvs_autotune_get_point(0, freq);
+    for (int i = 0; i < PSVS_AUTOTUNE_DEVICE_N; i++) {
+        psvs_oc_device_t device = g_autotune_sweep[i].device;
+        profile.mode[device] = PSVS_OC_MODE_MANUAL;
+        profile.manual_freq[device] = freq[device];
+    }
+    psvs_oc_set_profile(&profile, NULL);
+    _psvs_autotune_apply(0);
+
+    g_autotune_state = PSVS_AUTOTUNE_STATE_RUNNING;
+}
+
+void psvs_autotune_toggle() {
+    switch (g_autotune_state) {
+        case PSVS_AUTOTUNE_STATE_IDLE:
+            _psvs_autotune_start();
+            break;
+        case PSVS_AUTOTUNE_STATE_RUNNING:
+            _psvs_autotune_restore();
+            g_autotune_state = PSVS_AUTOTUNE_STATE_FAILED;
+            break;
+        default: // dismiss result
+            g_autotune_state = PSVS_AUTOTUNE_STATE_IDLE;
+            break;
+    }
+}
+
+// Point is on the front unless another one is as fast for as little clock
+static void _psvs_autotune_mark_front() {
+    for (int i = 0; i < g_autotune_point_n; i++) {
+        psvs_autotune_point_t *p = &g_autotune_points[i];
+        p->front = p->fps10 > 0;
+
+        for (int j = 0; j < g_autotune_point_n && p->front; j++) {
+            psvs_autotune_point_t *q = &g_autotune_points[j];
+            if (j == i || q->fps10 == 0)
+                continue;
+            if (q->total <= p->total && q->fps10 >= p->fps10
+                    && (q->total < p->total || q->fps10 > p->fps10 || j < i))
+                p->front = false;
+        }
+    }
+}
+
+// Cheapest front point within 3% of best FPS and 10% of best 1% low
+static int _psvs_autotune_choose() {
+    int best_fps10 = 0, best_low_1 = 0;
+    for (int i = 0; i < g_autotune_point_n; i++) {
+        if (g_autotune_points[i].fps10 > best_fps10)
+            best_fps10 = g_autotune_points[i].fps10;
+        if (g_autotune_points[i].low_1 > best_low_1)
+            best_low_1 = g_autotune_points[i].low_1;
+    }
+    if (best_fps10 == 0)
+        return -1;
+
+    for (int pass = 0; pass < 2; pass++) {
+        int chosen = -1;
+        for (int i = 0; i < g_autotune_point_n; i++) {
+            const psvs_autotune_point_t *p = &g_autotune_points[i];
+            if (!p->front || p->fps10 * 100 < best_fps10 * 97)
+                continue;
+            if (pass == 0 && p->low_1 * 10 < best_low_1 * 9)
+                continue; // 1% low only matters if any point satisfies it
+            if (chosen < 0 || p->total < g_autotune_points[chosen].total)
+                chosen = i;
+        }
+        if (chosen >= 0)
+            return chosen;
+    }
+    return -1;
+}
+
+static void _psvs_autotune_write_report(int chosen) {
+    char path[128];
+    snprintf(path, 128, "%s%s.txt", PSVS_AUTOTUNE_DIR, g_titleid);
+
+    SceUID fd = ksceIoOpen(path, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+    if (fd < 0)
+        return;
+
+    char buf[128];
+    int len = snprintf(buf, sizeof(buf), "== %s ==\n CPU ES4 BUS XBR  total    fps  1%%low\n", g_titleid);
+    ksceIoWrite(fd, buf, len);
+
+    for (int i = 0; i < g_autotune_point_n; i++) {
+        const psvs_autotune_point_t *p = &g_autotune_points[i];
+        len = snprintf(buf, sizeof(buf), "%4d %3d %3d %3d  %5d  %3d.%d  %5d %s\n",
+                       p->freq[0], p->freq[1], p->freq[2], p->freq[3], p->total,
+                       p->fps10 / 10, p->fps10 % 10, p->low_1,
+                       i == chosen ? "<- chosen" : p->front ? "front" : "");
+        ksceIoWrite(fd, buf, len);
+    }
+
+    ksceIoClose(fd);
+}
+
+static void _psvs_autotune_finish() {
+    _psvs_autotune_mark_front();
+    int chosen = _psvs_autotune_choose();
+    _psvs_autotune_write_report(chosen);
+
+    if (chosen < 0) {
+        _psvs_autotune_restore();
+        g_autotune_state = PSVS_AUTOTUNE_STATE_FAILED;
+        return;
+    }
+
+    // Keep the rest of the profile, tuned devices go manual in one transition
+    psvs_oc_profile_t profile;
+    memcpy(&profile, &g_autotune_profile, sizeof(psvs_oc_profile_t));
+    for (int i = 0; i < PSVS_AUTOTUNE_DEVICE_N; i++) {
+        psvs_oc_device_t device = g_autotune_sweep[i].device;
+        profile.mode[device] = PSVS_OC_MODE_MANUAL;
+        profile.manual_freq[device] = g_autotune_points[chosen].freq[i];
+    }
+    psvs_oc_set_profile(&profile, NULL);
+    psvs_oc_set_changed(true);
+
+    psvs_profile_save(false);
+    g_autotune_state = PSVS_AUTOTUNE_STATE_DONE;
+}
+
+// Called from psvs_thread
+void psvs_autotune_update() {
+    if (g_autotune_state != PSVS_AUTOTUNE_STATE_RUNNING)
+        return;
+
+    // App went away, its profile is loaded already
+    if (g_pid != g_autotune_pid) {
+        g_autotune_state = PSVS_AUTOTUNE_STATE_FAILED;
+        return;
+    }
+
+    SceUInt32 tick_now = ksceKernelGetProcessTimeLowCore();
+    SceUInt32 elapsed = tick_now - g_autotune_tick_start;
+    uint32_t count = psvs_perf_get_frame_count();
+
+    // Let clocks and frame pacing settle
+    if (!g_autotune_measuring) {
+        if (elapsed < PSVS_AUTOTUNE_SETTLE)
+            return;
+
+        g_autotune_measuring = true;
+        g_autotune_tick_start = tick_now;
+        g_autotune_frame_last = count;
+        g_autotune_frames = 0;
+        memset(&g_autotune_hist, 0, sizeof(psvs_frametime_hist_t));
+        return;
+    }
+
+    // Collect frames since last update
+    if (count - g_autotune_frame_last > PSVS_PERF_FRAMETIME_HISTORY)
+        g_autotune_frame_last = count - PSVS_PERF_FRAMETIME_HISTORY;
+    for (; g_autotune_frame_last != count; g_autotune_frame_last++) {
+        psvs_perf_hist_add(&g_autotune_hist, psvs_perf_get_frametime(g_autotune_frame_last));
+        g_autotune_frames++;
+    }
+
+    if (elapsed < PSVS_AUTOTUNE_MEASURE)
+        return;
+
+    psvs_autotune_point_t *p = &g_autotune_points[g_autotune_point];
+    psvs_frametime_stats_t stats;
+    psvs_perf_hist_stats(&g_autotune_hist, g_autotune_frames, &stats);
+    p->fps10 = ((uint64_t)g_autotune_frames * 10 * SECOND + (elapsed / 2)) / elapsed;
+    p->low_1 = stats.low_1;
+    p->total = 0;
+    for (int i = 0; i < PSVS_AUTOTUNE_DEVICE_N; i++) {
+        p->freq[i] = psvs_oc_get_freq(g_autotune_sweep[i].device); // thermal ceiling may apply
+        p->total += p->freq[i];
+    }
+
+    if (++g_autotune_point >= g_autotune_point_n) {
+        _psvs_autotune_finish();
+        return;
+    }
+    _psvs_autotune_apply(g_autotune_point);
+}
+
+void psvs_autotune_init() {
+    ksceIoMkdir(PSVS_AUTOTUNE_DIR, 0777);
+}
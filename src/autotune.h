@@ -0,0 +1,34 @@
+#ifndef _AUTOTUNE_H_
+#define _AUTOTUNE_H_
+
+#define PSVS_AUTOTUNE_DIR "ur0:data/PSVshell_fork/autotune/"
+
+#define PSVS_AUTOTUNE_SETTLE 1000 * 1000  // us at new clocks before measuring
+#define PSVS_AUTOTUNE_MEASURE 3000 * 1000 // us measured per combination
+#define PSVS_AUTOTUNE_DEVICE_N 4          // CPU, ES4, BUS, XBAR
+#define PSVS_AUTOTUNE_POINT_MAX 64        // swept combinations, 48 with the current floors
+
+typedef enum {
+    PSVS_AUTOTUNE_STATE_IDLE,
+    PSVS_AUTOTUNE_STATE_RUNNING,
+    PSVS_AUTOTUNE_STATE_DONE,   // result saved as title profile
+    PSVS_AUTOTUNE_STATE_FAILED, // cancelled, app changed or no frames
+} psvs_autotune_state_t;
+
+typedef struct {
+    int freq[PSVS_AUTOTUNE_DEVICE_N]; // MHz, as read back after settling
+    int total;                        // MHz, sum of above
+    int fps10;                        // avg FPS x10
+    int low_1;                        // 1% low FPS
+    bool front;                       // on the Pareto front
+} psvs_autotune_point_t;
+
+void psvs_autotune_toggle();
+void psvs_autotune_update();
+bool psvs_autotune_is_running();
+psvs_autotune_state_t psvs_autotune_get_state();
+void psvs_autotune_get_progress(int *done, int *total);
+
+void psvs_autotune_init();
+
+#endif
@@ -0,0 +1,173 @@
+#include <vitasdkkern.h>
+#include <stdbool.h>
+#ifdef __ARM_NEON__
+#include <arm_neon.h>
+#endif
+
+#include "gui.h"
+#include "blit.h"
+
+// (s * a + d * (255 - a)) / 255, rounded to nearest
+static inline uint8_t _psvs_blit_blend_ch(uint32_t s, uint32_t d, uint32_t a) {
+    uint32_t t = s * a + d * (255 - a);
+    return (t + ((t + 128) >> 8) + 128) >> 8;
+}
+
+void psvs_blit_blend_row_ref(rgba_t *dst, const rgba_t *src, int n) {
+    for (int i = 0; i < n; i++) {
+        uint32_t a = src[i].rgba.a;
+        dst[i].rgba.r = _psvs_blit_blend_ch(src[i].rgba.r, dst[i].rgba.r, a);
+        dst[i].rgba.g = _psvs_blit_blend_ch(src[i].rgba.g, dst[i].rgba.g, a);
+        dst[i].rgba.b = _psvs_blit_blend_ch(src[i].rgba.b, dst[i].rgba.b, a);
+    }
+}
+
+#ifdef __ARM_NEON__
+void psvs_blit_blend_row(rgba_t *dst, const rgba_t *src, int n) {
+    int i = 0;
+
+    // 8 px per iteration, deinterleaved into r/g/b/a lanes
+    for (; i + 8 <= n; i += 8) {
+        uint8x8x4_t s = vld4_u8((const uint8_t *)&src[i]);
+        uint8x8x4_t d = vld4_u8((const uint8_t *)&dst[i]);
+        uint8x8_t a = s.val[3];
+        uint8x8_t ia = vmvn_u8(a);
+
+        for (int c = 0; c < 3; c++) {
+            uint16x8_t t = vmull_u8(s.val[c], a);
+            t = vmlal_u8(t, d.val[c], ia);
+            d.val[c] = vraddhn_u16(t, vrshrq_n_u16(t, 8)); // same rounding as ref
+        }
+
+        vst4_u8((uint8_t *)&dst[i], d);
+    }
+
+    psvs_blit_blend_row_ref(&dst[i], &src[i], n - i);
+}
+#else
+void psvs_blit_blend_row(rgba_t *dst, const rgba_t *src, int n) {
+    psvs_blit_blend_row_ref(dst, src, n);
+}
+#endif
+
+void psvs_blit_expand_row(uint32_t *dst, const uint8_t *src, const uint32_t *palette, int n) {
+    // NEON vtbl only indexes up to 32 bytes, a 256 entry palette is looked up per px
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        dst[i + 0] = palette[src[i + 0]];
+        dst[i + 1] = palette[src[i + 1]];
+        dst[i + 2] = palette[src[i + 2]];
+        dst[i + 3] = palette[src[i + 3]];
+    }
+    for (; i < n; i++)
+        dst[i] = palette[src[i]];
+}
+
+void psvs_blit_glyph_half(uint16_t *dst, const uint16_t *src, int width, int height) {
+    int half_w = (width + 1) >> 1;
+    int half_h = (height + 1) >> 1;
+
+    for (int yy = 0; yy < half_h; yy++) {
+        uint16_t row = src[yy << 1];
+        uint16_t mask = 0;
+
+        for (int xx = 0; xx < half_w; xx++)
+            mask |= ((row >> (xx << 1)) & 1) << xx;
+
+        dst[yy] = mask;
+    }
+}
+
+int psvs_blit_glyph_spans(psvs_blit_span_t *spans, const uint16_t *rows, int width, int height) {
+    int n = 0;
+
+    for (int yy = 0; yy < height; yy++) {
+        for (int xx = 0; xx < width; xx++) {
+            if (!((rows[yy] >> xx) & 1))
+                continue;
+
+            psvs_blit_span_t *span = &spans[n++];
+            span->y = yy;
+            span->x = xx;
+            while (xx < width && ((rows[yy] >> xx) & 1))
+                xx++;
+            span->len = xx - span->x;
+        }
+    }
+
+    return n;
+}
+
+// Scalar pack/unpack between rgba_t and fb px, the reference conversions
+static inline uint32_t _psvs_blit_pack_A8B8G8R8(rgba_t c) {
+    return c.uint32;
+}
+
+static inline rgba_t _psvs_blit_unpack_A8B8G8R8(uint32_t px) {
+    rgba_t c = {.uint32 = px};
+    return c;
+}
+
+static inline uint32_t _psvs_blit_pack_A2B10G10R10(rgba_t c) {
+    // Widen 8-bit channels by bit replication
+    return ((uint32_t)(c.rgba.a >> 6) << 30)
+            | ((uint32_t)((c.rgba.b << 2) | (c.rgba.b >> 6)) << 20)
+            | ((uint32_t)((c.rgba.g << 2) | (c.rgba.g >> 6)) << 10)
+            | ((uint32_t)((c.rgba.r << 2) | (c.rgba.r >> 6)));
+}
+
+static inline rgba_t _psvs_blit_unpack_A2B10G10R10(uint32_t px) {
+    rgba_t c;
+    c.rgba.r = (px >> 2) & 0xFF;
+    c.rgba.g = (px >> 12) & 0xFF;
+    c.rgba.b = (px >> 22) & 0xFF;
+    c.rgba.a = ((px >> 30) & 0x3) * 0x55;
+    return c;
+}
+
+// Generate pack kernel for pixel format
+#define PSVS_BLIT_DECL_PACK(fmt) \
+    static uint32_t _psvs_blit_pack_fn_##fmt(rgba_t color) { \
+        return _psvs_blit_pack_##fmt(color); \
+    }
+
+// Generate generic blend kernel for non-native pixel format (blending is done at 8-bit)
+#define PSVS_BLIT_DECL_BLEND_ROW(fmt) \
+    static void _psvs_blit_blend_row_##fmt(uint32_t *dst, const rgba_t *src, int n) { \
+        for (int i = 0; i < n; i++) { \
+            rgba_t d = _psvs_blit_unpack_##fmt(dst[i]); \
+            psvs_blit_blend_row_ref(&d, &src[i], 1); \
+            dst[i] = _psvs_blit_pack_##fmt(d); \
+        } \
+    }
+
+PSVS_BLIT_DECL_PACK(A8B8G8R8)
+PSVS_BLIT_DECL_PACK(A2B10G10R10)
+PSVS_BLIT_DECL_BLEND_ROW(A2B10G10R10)
+
+// Native format, fb px layout matches rgba_t
+static void _psvs_blit_blend_row_native(uint32_t *dst, const rgba_t *src, int n) {
+    psvs_blit_blend_row((rgba_t *)dst, src, n);
+}
+
+static const psvs_blit_ops_t g_blit_ops[] = {
+    {
+        .pixelformat = PSVS_BLIT_PIXELFORMAT_A8B8G8R8,
+        .pack = _psvs_blit_pack_fn_A8B8G8R8,
+        .blend_row = _psvs_blit_blend_row_native
+    },
+    {
+        .pixelformat = PSVS_BLIT_PIXELFORMAT_A2B10G10R10,
+        .pack = _psvs_blit_pack_fn_A2B10G10R10,
+        .blend_row = _psvs_blit_blend_row_A2B10G10R10
+    },
+};
+
+const psvs_blit_ops_t *psvs_blit_get_ops(uint32_t pixelformat) {
+    for (int i = 0; i < sizeof(g_blit_ops) / sizeof(g_blit_ops[0]); i++) {
+        if (g_blit_ops[i].pixelformat == pixelformat)
+            return &g_blit_ops[i];
+    }
+
+    return NULL;
+}
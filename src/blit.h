@@ -0,0 +1,40 @@
+#ifndef _BLIT_H_
+#define _BLIT_H_
+
+// SceDisplayFrameBuf.pixelformat values
+#define PSVS_BLIT_PIXELFORMAT_A8B8G8R8    0x00000000U
+#define PSVS_BLIT_PIXELFORMAT_A2B10G10R10 0x60000000U
+
+// Per pixel format kernels, all supported formats are 32bpp
+typedef struct {
+    uint32_t pixelformat;
+    uint32_t (*pack)(rgba_t color);
+    void (*blend_row)(uint32_t *dst, const rgba_t *src, int n);
+} psvs_blit_ops_t;
+
+// Returns NULL if pixelformat is not supported
+const psvs_blit_ops_t *psvs_blit_get_ops(uint32_t pixelformat);
+
+// Expand n palette indexes of src into dst
+void psvs_blit_expand_row(uint32_t *dst, const uint8_t *src, const uint32_t *palette, int n);
+
+// Blend n px of src over dst, using src alpha (dst alpha is kept)
+void psvs_blit_blend_row(rgba_t *dst, const rgba_t *src, int n);
+
+// Scalar reference, bit-exact with psvs_blit_blend_row()
+void psvs_blit_blend_row_ref(rgba_t *dst, const rgba_t *src, int n);
+
+// Glyphs are row masks, bit n set => px at column n
+typedef struct {
+    uint8_t y;
+    uint8_t x;
+    uint8_t len;
+} psvs_blit_span_t;
+
+// Half size glyph from every other row and column, dst is (height + 1) / 2 rows
+void psvs_blit_glyph_half(uint16_t *dst, const uint16_t *src, int width, int height);
+
+// Split glyph into runs of set px, returns span count (up to height * ((width + 1) / 2))
+int psvs_blit_glyph_spans(psvs_blit_span_t *spans, const uint16_t *rows, int width, int height);
+
+#endif
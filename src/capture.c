@@ -0,0 +1,296 @@
+#include <vitasdkkern.h>
+#include <taihen.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "oc.h"
+#include "perf.h"
+#include "capture.h"
+
+SceUInt32 ksceKernelGetProcessTimeLowCore();
+
+_Static_assert(sizeof(psvs_capture_header_t) == 40, "capture header layout changed, bump version");
+_Static_assert(sizeof(psvs_capture_record_t) == 24, "capture record layout changed, bump version");
+
+// Records are queued by the display hook and written by the worker
+#define PSVS_CAPTURE_RING_N 2048 // must be power of 2
+#define PSVS_CAPTURE_BATCH_N 512 // write once this many are queued
+#define PSVS_CAPTURE_WORKER_DELAY (250 * 1000)
+
+typedef enum {
+    PSVS_CAPTURE_STATE_IDLE,
+    PSVS_CAPTURE_STATE_STARTING, // worker opens file
+    PSVS_CAPTURE_STATE_RUNNING,
+    PSVS_CAPTURE_STATE_STOPPING  // worker writes the rest and closes file
+} psvs_capture_state_t;
+
+// Values polled by psvs_thread, double buffered for the hook
+typedef struct {
+    uint8_t load[4];
+    uint16_t freq[PSVS_OC_DEVICE_MAX];
+    int8_t batt_temp;
+    uint8_t batt_percent;
+} psvs_capture_sample_t;
+
+static psvs_capture_state_t g_capture_state = PSVS_CAPTURE_STATE_IDLE;
+
+// Allocated by the worker for the duration of a capture
+static SceUID g_capture_ring_uid = -1;
+static psvs_capture_record_t *g_capture_ring = NULL;
+static bool g_capture_hook_busy = false;  // hook side, ring is in use
+static uint32_t g_capture_head = 0;       // hook side
+static uint32_t g_capture_tail = 0;       // worker side
+static uint32_t g_capture_dropped = 0;    // hook side
+static uint32_t g_capture_frame_last = 0; // hook side
+
+static psvs_capture_sample_t g_capture_samples[2];
+static int g_capture_sample_cur = 0;
+
+static SceUID g_capture_thread_uid = -1;
+static bool g_capture_thread_run = true;
+static SceUID g_capture_fd = -1;
+static psvs_capture_header_t g_capture_header;
+static bool g_capture_failed = false; // last capture could not be written
+
+static bool _psvs_capture_set_state(psvs_capture_state_t from, psvs_capture_state_t to) {
+    return __atomic_compare_exchange_n(&g_capture_state, &from, to, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+bool psvs_capture_is_running() {
+    return __atomic_load_n(&g_capture_state, __ATOMIC_ACQUIRE) == PSVS_CAPTURE_STATE_RUNNING;
+}
+
+bool psvs_capture_has_failed() {
+    return __atomic_load_n(&g_capture_failed, __ATOMIC_ACQUIRE);
+}
+
+bool psvs_capture_start() {
+    if (!_psvs_capture_set_state(PSVS_CAPTURE_STATE_IDLE, PSVS_CAPTURE_STATE_STARTING))
+        return false;
+
+    __atomic_store_n(&g_capture_failed, false, __ATOMIC_RELEASE);
+    return true;
+}
+
+void psvs_capture_stop() {
+    if (!_psvs_capture_set_state(PSVS_CAPTURE_STATE_RUNNING, PSVS_CAPTURE_STATE_STOPPING))
+        _psvs_capture_set_state(PSVS_CAPTURE_STATE_STARTING, PSVS_CAPTURE_STATE_IDLE);
+}
+
+// Called from display hook, only copies into the ring buffer
+void psvs_capture_frame() {
+    // Worker frees the ring only once it sees the hook is out
+    __atomic_store_n(&g_capture_hook_busy, true, __ATOMIC_SEQ_CST);
+    if (!psvs_capture_is_running())
+        goto CAPTURE_FRAME_RET;
+
+    uint32_t count = psvs_perf_get_frame_count();
+    if (count == g_capture_frame_last)
+        goto CAPTURE_FRAME_RET; // re-present, not a new frame
+
+    SceUInt32 tick_now = ksceKernelGetProcessTimeLowCore();
+    const psvs_capture_sample_t *sample = &g_capture_samples[__atomic_load_n(&g_capture_sample_cur, __ATOMIC_ACQUIRE)];
+    uint32_t tail = __atomic_load_n(&g_capture_tail, __ATOMIC_ACQUIRE);
+
+    for (; g_capture_frame_last != count; g_capture_frame_last++) {
+        if (g_capture_head - tail >= PSVS_CAPTURE_RING_N) {
+            g_capture_dropped++; // worker is behind
+            continue;
+        }
+
+        psvs_capture_record_t *record = &g_capture_ring[g_capture_head & (PSVS_CAPTURE_RING_N - 1)];
+        record->timestamp = tick_now;
+        record->frametime = psvs_perf_get_frametime(g_capture_frame_last);
+        memcpy(record->load, sample->load, sizeof(record->load));
+        memcpy(record->freq, sample->freq, sizeof(record->freq));
+        record->batt_temp = sample->batt_temp;
+        record->batt_percent = sample->batt_percent;
+
+        __atomic_store_n(&g_capture_head, g_capture_head + 1, __ATOMIC_RELEASE);
+    }
+
+CAPTURE_FRAME_RET:
+    __atomic_store_n(&g_capture_hook_busy, false, __ATOMIC_SEQ_CST);
+}
+
+// Called from psvs_thread after polling perf
+void psvs_capture_sample() {
+    if (__atomic_load_n(&g_capture_state, __ATOMIC_ACQUIRE) == PSVS_CAPTURE_STATE_IDLE)
+        return;
+
+    int next = !g_capture_sample_cur;
+    psvs_capture_sample_t *sample = &g_capture_samples[next];
+    psvs_battery_t *batt = psvs_perf_get_batt();
+
+    for (int i = 0; i < 4; i++)
+        sample->load[i] = psvs_perf_get_load(i);
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++)
+        sample->freq[i] = psvs_oc_get_freq(i);
+    sample->batt_temp = batt->temp;
+    sample->batt_percent = batt->percent;
+
+    __atomic_store_n(&g_capture_sample_cur, next, __ATOMIC_RELEASE);
+}
+
+static bool _psvs_capture_alloc() {
+    int size = (PSVS_CAPTURE_RING_N * sizeof(psvs_capture_record_t) + 0xfff) & ~0xfff;
+    g_capture_ring_uid = ksceKernelAllocMemBlock("psvs_capture", SCE_KERNEL_MEMBLOCK_TYPE_KERNEL_RW, size, NULL);
+    if (g_capture_ring_uid < 0)
+        return false;
+
+    ksceKernelGetMemBlockBase(g_capture_ring_uid, (void **)&g_capture_ring);
+    return true;
+}
+
+// State must have left RUNNING, waits for the hook to stop using the ring
+static void _psvs_capture_wait_hook() {
+    while (__atomic_load_n(&g_capture_hook_busy, __ATOMIC_SEQ_CST))
+        ksceKernelDelayThread(1000);
+}
+
+static void _psvs_capture_free() {
+    if (g_capture_ring_uid < 0)
+        return;
+
+    g_capture_ring = NULL;
+    ksceKernelFreeMemBlock(g_capture_ring_uid);
+    g_capture_ring_uid = -1;
+}
+
+static bool _psvs_capture_open() {
+    SceDateTime time;
+    ksceRtcGetCurrentClockLocalTime(&time);
+
+    char path[128];
+    snprintf(path, 128, "%s%s_%04d%02d%02d_%02d%02d%02d.psvscap", PSVS_CAPTURE_DIR, g_titleid,
+             time.year, time.month, time.day, time.hour, time.minute, time.second);
+
+    g_capture_fd = ksceIoOpen(path, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+    if (g_capture_fd < 0)
+        return false;
+
+    memset(&g_capture_header, 0, sizeof(psvs_capture_header_t));
+    memcpy(g_capture_header.magic, PSVS_CAPTURE_MAGIC, sizeof(g_capture_header.magic));
+    g_capture_header.version = PSVS_CAPTURE_VERSION;
+    g_capture_header.header_size = sizeof(psvs_capture_header_t);
+    g_capture_header.record_size = sizeof(psvs_capture_record_t);
+    strncpy(g_capture_header.titleid, g_titleid, sizeof(g_capture_header.titleid) - 1);
+
+    if (ksceIoWrite(g_capture_fd, &g_capture_header, sizeof(psvs_capture_header_t)) != sizeof(psvs_capture_header_t)) {
+        ksceIoClose(g_capture_fd);
+        g_capture_fd = -1;
+        return false;
+    }
+
+    // Hook does not touch these until state is RUNNING
+    g_capture_head = 0;
+    g_capture_tail = 0;
+    g_capture_dropped = 0;
+    g_capture_frame_last = psvs_perf_get_frame_count();
+    return true;
+}
+
+// Returns false on a failed or short write
+static bool _psvs_capture_flush(bool all) {
+    uint32_t head = __atomic_load_n(&g_capture_head, __ATOMIC_ACQUIRE);
+
+    while (head - g_capture_tail >= PSVS_CAPTURE_BATCH_N || (all && head != g_capture_tail)) {
+        // Write up to ring end in one go
+        uint32_t index = g_capture_tail & (PSVS_CAPTURE_RING_N - 1);
+        uint32_t n = head - g_capture_tail;
+        if (n > PSVS_CAPTURE_RING_N - index)
+            n = PSVS_CAPTURE_RING_N - index;
+
+        int size = n * sizeof(psvs_capture_record_t);
+        if (ksceIoWrite(g_capture_fd, &g_capture_ring[index], size) != size)
+            return false;
+        g_capture_header.record_n += n;
+        __atomic_store_n(&g_capture_tail, g_capture_tail + n, __ATOMIC_RELEASE);
+    }
+
+    return true;
+}
+
+// Returns false if counts could not be written
+static bool _psvs_capture_close() {
+    // Fill in counts, records past record_n are partial
+    g_capture_header.dropped_n = g_capture_dropped;
+    bool ok = ksceIoLseek(g_capture_fd, 0, SCE_SEEK_SET) == 0
+            && ksceIoWrite(g_capture_fd, &g_capture_header, sizeof(psvs_capture_header_t)) == sizeof(psvs_capture_header_t);
+
+    ksceIoClose(g_capture_fd);
+    g_capture_fd = -1;
+    return ok;
+}
+
+// Worker side end of a capture, state is no longer RUNNING
+static void _psvs_capture_finish(bool ok) {
+    _psvs_capture_wait_hook();
+    if (g_capture_fd >= 0) {
+        ok = ok && _psvs_capture_flush(true);
+        ok = _psvs_capture_close() && ok;
+    }
+    _psvs_capture_free();
+
+    if (!ok)
+        __atomic_store_n(&g_capture_failed, true, __ATOMIC_RELEASE);
+}
+
+static int psvs_capture_thread(SceSize args, void *argp) {
+    while (g_capture_thread_run) {
+        ksceKernelDelayThread(PSVS_CAPTURE_WORKER_DELAY);
+
+        switch (__atomic_load_n(&g_capture_state, __ATOMIC_ACQUIRE)) {
+            case PSVS_CAPTURE_STATE_STARTING:
+                if (!_psvs_capture_alloc() || !_psvs_capture_open()) {
+                    _psvs_capture_finish(false);
+                    _psvs_capture_set_state(PSVS_CAPTURE_STATE_STARTING, PSVS_CAPTURE_STATE_IDLE);
+                } else if (!_psvs_capture_set_state(PSVS_CAPTURE_STATE_STARTING, PSVS_CAPTURE_STATE_RUNNING)) {
+                    _psvs_capture_finish(true); // stopped meanwhile
+                }
+                break;
+            case PSVS_CAPTURE_STATE_RUNNING:
+                // Stop on a short write, e.g. memory card full
+                if (!_psvs_capture_flush(false)
+                        && _psvs_capture_set_state(PSVS_CAPTURE_STATE_RUNNING, PSVS_CAPTURE_STATE_STOPPING)) {
+                    _psvs_capture_finish(false);
+                    _psvs_capture_set_state(PSVS_CAPTURE_STATE_STOPPING, PSVS_CAPTURE_STATE_IDLE);
+                }
+                break;
+            case PSVS_CAPTURE_STATE_STOPPING:
+                _psvs_capture_finish(true);
+                _psvs_capture_set_state(PSVS_CAPTURE_STATE_STOPPING, PSVS_CAPTURE_STATE_IDLE);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Don't lose a running capture on unload
+    __atomic_store_n(&g_capture_state, PSVS_CAPTURE_STATE_IDLE, __ATOMIC_SEQ_CST);
+    _psvs_capture_finish(true);
+
+    return 0;
+}
+
+int psvs_capture_init() {
+    ksceIoMkdir(PSVS_CAPTURE_DIR, 0777);
+
+    // Low priority, file writes must never compete with the game
+    g_capture_thread_uid = ksceKernelCreateThread("psvs_capture_thread", psvs_capture_thread, 0xA0, 0x2000, 0, 0x10000, 0);
+    if (g_capture_thread_uid < 0)
+        return g_capture_thread_uid;
+
+    ksceKernelStartThread(g_capture_thread_uid, 0, NULL);
+    return 0;
+}
+
+void psvs_capture_deinit() {
+    if (g_capture_thread_uid >= 0) {
+        g_capture_thread_run = false;
+        ksceKernelWaitThreadEnd(g_capture_thread_uid, NULL, NULL);
+        ksceKernelDeleteThread(g_capture_thread_uid);
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef _CAPTURE_H_
+#define _CAPTURE_H_
+
+#define PSVS_CAPTURE_DIR "ur0:data/PSVshell_fork/captures/"
+
+// File format, all little-endian: header, then records until EOF.
+// Bump version on any layout change, tools/psvs_capture.py decodes it.
+#define PSVS_CAPTURE_MAGIC   "PSVSCAP"
+#define PSVS_CAPTURE_VERSION 1
+
+typedef struct {
+    char magic[8];         // PSVS_CAPTURE_MAGIC
+    uint16_t version;      // PSVS_CAPTURE_VERSION
+    uint16_t header_size;  // sizeof(psvs_capture_header_t)
+    uint16_t record_size;  // sizeof(psvs_capture_record_t)
+    uint16_t reserved;
+    char titleid[16];
+    uint32_t record_n;     // written on stop
+    uint32_t dropped_n;    // records lost to a full ring buffer
+} psvs_capture_header_t;
+
+// One per unique frame
+typedef struct {
+    uint32_t timestamp;    // process time, us
+    uint32_t frametime;    // us
+    uint8_t load[4];       // per-core load, %
+    uint16_t freq[PSVS_OC_DEVICE_MAX]; // MHz
+    int8_t batt_temp;      // C
+    uint8_t batt_percent;
+} psvs_capture_record_t;
+
+void psvs_capture_frame();
+void psvs_capture_sample();
+
+bool psvs_capture_start();
+void psvs_capture_stop();
+bool psvs_capture_is_running();
+bool psvs_capture_has_failed();
+
+int psvs_capture_init();
+void psvs_capture_deinit();
+
+#endif
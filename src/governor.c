@@ -0,0 +1,209 @@
+#include <vitasdkkern.h>
+#include <taihen.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "main.h"
+#include "oc.h"
+#include "perf.h"
+#include "governor.h"
+
+SceUInt32 ksceKernelGetProcessTimeLowCore();
+
+#define SECOND 1000000
+
+// Devices stepped by the governor, in step down order
+static const psvs_oc_device_t g_governor_devices[] = {
+    PSVS_OC_DEVICE_CPU,
+    PSVS_OC_DEVICE_GPU_ES4,
+    PSVS_OC_DEVICE_BUS,
+    PSVS_OC_DEVICE_GPU_XBAR
+};
+#define PSVS_GOVERNOR_DEVICE_N (sizeof(g_governor_devices) / sizeof(g_governor_devices[0]))
+
+static SceUID g_governor_pid = INVALID_PID;
+static int g_governor_target_fps = 0;
+static SceUInt32 g_governor_tick_last = 0;
+static uint32_t g_governor_frame_last = 0;
+static psvs_frametime_hist_t g_governor_hist;
+
+static int g_governor_good = 0;   // consecutive intervals on target
+static int g_governor_cursor = 0; // next device to step down
+static psvs_oc_device_t g_governor_probe = PSVS_OC_DEVICE_MAX; // stepped down last, not proven yet
+static int g_governor_floor[PSVS_OC_DEVICE_MAX] = {0};    // lowest step allowed
+static int g_governor_cooldown[PSVS_OC_DEVICE_MAX] = {0}; // intervals until floor is lifted
+
+bool psvs_governor_is_active() {
+    if (psvs_oc_get_target_fps() <= 0)
+        return false;
+
+    for (int i = 0; i < PSVS_GOVERNOR_DEVICE_N; i++) {
+        if (psvs_oc_get_mode(g_governor_devices[i]) == PSVS_OC_MODE_GOVERNOR)
+            return true;
+    }
+    return false;
+}
+
+void psvs_governor_reset() {
+    g_governor_tick_last = ksceKernelGetProcessTimeLowCore();
+    g_governor_frame_last = psvs_perf_get_frame_count();
+    g_governor_good = 0;
+    g_governor_probe = PSVS_OC_DEVICE_MAX;
+    memset(g_governor_floor, 0, sizeof(g_governor_floor));
+    memset(g_governor_cooldown, 0, sizeof(g_governor_cooldown));
+}
+
+static int _psvs_governor_get_step(psvs_oc_device_t device) {
+    int freq_n;
+    const int *freq = psvs_oc_get_freq_table(device, &freq_n);
+    int cur = psvs_oc_get_governor_freq(device);
+
+    for (int i = 0; i < freq_n; i++) {
+        if (freq[i] >= cur)
+            return i;
+    }
+    return freq_n - 1;
+}
+
+static bool _psvs_governor_step(psvs_oc_device_t device, bool raise_freq) {
+    if (psvs_oc_get_mode(device) != PSVS_OC_MODE_GOVERNOR)
+        return false;
+
+    int freq_n;
+    const int *freq = psvs_oc_get_freq_table(device, &freq_n);
+    int step = _psvs_governor_get_step(device) + (raise_freq ? 1 : -1);
+    if (step < 0 || step >= freq_n || step < g_governor_floor[device])
+        return false;
+
+    psvs_oc_set_governor_freq(device, freq[step]);
+    return true;
+}
+
+static int _psvs_governor_get_max_load() {
+    int max_load = 0;
+    for (int i = 0; i < 4; i++) {
+        int load = psvs_perf_get_load(i);
+        if (load > max_load)
+            max_load = load;
+    }
+    return max_load;
+}
+
+// Raise the likely bottleneck, CPU when a core is busy, GPU side otherwise
+static bool _psvs_governor_raise() {
+    static const psvs_oc_device_t gpu_first[] = {
+        PSVS_OC_DEVICE_GPU_ES4,
+        PSVS_OC_DEVICE_BUS,
+        PSVS_OC_DEVICE_GPU_XBAR,
+        PSVS_OC_DEVICE_CPU
+    };
+
+    if (_psvs_governor_get_max_load() >= PSVS_GOVERNOR_CPU_BUSY
+            && _psvs_governor_step(PSVS_OC_DEVICE_CPU, true))
+        return true;
+
+    for (int i = 0; i < PSVS_GOVERNOR_DEVICE_N; i++) {
+        if (_psvs_governor_step(gpu_first[i], true))
+            return true;
+    }
+    return false;
+}
+
+// Step down one device, round robin so all get their turn
+static bool _psvs_governor_lower() {
+    int max_load = _psvs_governor_get_max_load();
+
+    for (int i = 0; i < PSVS_GOVERNOR_DEVICE_N; i++) {
+        int index = (g_governor_cursor + i) % PSVS_GOVERNOR_DEVICE_N;
+        psvs_oc_device_t device = g_governor_devices[index];
+        if (device == PSVS_OC_DEVICE_CPU && max_load >= PSVS_GOVERNOR_CPU_IDLE)
+            continue;
+
+        if (_psvs_governor_step(device, false)) {
+            g_governor_cursor = (index + 1) % PSVS_GOVERNOR_DEVICE_N;
+            g_governor_probe = device;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Called from psvs_thread after polling perf
+void psvs_governor_update() {
+    if (!psvs_governor_is_active()) {
+        g_governor_target_fps = 0;
+        return;
+    }
+
+    // Start over on new app or target
+    int target_fps = psvs_oc_get_target_fps();
+    if (target_fps != g_governor_target_fps || g_pid != g_governor_pid) {
+        g_governor_target_fps = target_fps;
+        g_governor_pid = g_pid;
+        psvs_governor_reset();
+        return;
+    }
+
+    SceUInt32 tick_now = ksceKernelGetProcessTimeLowCore();
+    if (tick_now - g_governor_tick_last < PSVS_GOVERNOR_INTERVAL)
+        return;
+    g_governor_tick_last = tick_now;
+
+    // Collect frames since last decision
+    uint32_t count = psvs_perf_get_frame_count();
+    if (count - g_governor_frame_last > PSVS_PERF_FRAMETIME_HISTORY)
+        g_governor_frame_last = count - PSVS_PERF_FRAMETIME_HISTORY;
+    uint32_t frames = count - g_governor_frame_last;
+    uint64_t frametime_sum = 0;
+    memset(&g_governor_hist, 0, sizeof(psvs_frametime_hist_t));
+    for (; g_governor_frame_last != count; g_governor_frame_last++) {
+        uint32_t frametime = psvs_perf_get_frametime(g_governor_frame_last);
+        psvs_perf_hist_add(&g_governor_hist, frametime);
+        frametime_sum += frametime;
+    }
+
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        if (g_governor_cooldown[i] > 0 && --g_governor_cooldown[i] == 0)
+            g_governor_floor[i] = 0;
+    }
+
+    // Not rendering (loading, paused), nothing to judge
+    if (frames < target_fps / 4 + 1) {
+        g_governor_good = 0;
+        return;
+    }
+
+    psvs_frametime_stats_t stats;
+    psvs_perf_hist_stats(&g_governor_hist, frames, &stats);
+    uint32_t target_frametime = SECOND / target_fps;
+    uint32_t avg_frametime = frametime_sum / frames;
+
+    // Missing target, undo last step down or raise the bottleneck
+    if (avg_frametime * 100 > target_frametime * 105 || stats.p99 > target_frametime * 2) {
+        g_governor_good = 0;
+
+        psvs_oc_device_t probe = g_governor_probe;
+        g_governor_probe = PSVS_OC_DEVICE_MAX;
+        if (probe != PSVS_OC_DEVICE_MAX && _psvs_governor_step(probe, true)) {
+            // Don't try that step again for a while
+            g_governor_floor[probe] = _psvs_governor_get_step(probe);
+            g_governor_cooldown[probe] = PSVS_GOVERNOR_COOLDOWN;
+            return;
+        }
+
+        _psvs_governor_raise();
+        return;
+    }
+
+    // Holding target with margin, step down once it held for a while
+    if (avg_frametime * 100 <= target_frametime * 102 && stats.p99 * 2 <= target_frametime * 3) {
+        if (++g_governor_good >= PSVS_GOVERNOR_HOLD) {
+            g_governor_good = 0;
+            g_governor_probe = PSVS_OC_DEVICE_MAX; // last step down held
+            _psvs_governor_lower();
+        }
+        return;
+    }
+
+    // In between, hold clocks
+}
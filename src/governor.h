@@ -0,0 +1,14 @@
+#ifndef _GOVERNOR_H_
+#define _GOVERNOR_H_
+
+#define PSVS_GOVERNOR_INTERVAL 1000 * 1000 // decision period, us
+#define PSVS_GOVERNOR_HOLD 3               // intervals on target before stepping down
+#define PSVS_GOVERNOR_COOLDOWN 30          // intervals a failed step down stays blocked
+#define PSVS_GOVERNOR_CPU_BUSY 85          // max core load %, CPU is the bottleneck above
+#define PSVS_GOVERNOR_CPU_IDLE 60          // max core load %, CPU may step down below
+
+void psvs_governor_reset();
+void psvs_governor_update();
+bool psvs_governor_is_active();
+
+#endif
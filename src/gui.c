@@ -4,62 +4,171 @@
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <psp2kern/kernel/sysmem/memtype.h>
 
 #include "main.h"
 #include "gui.h"
-#include "gui_font_ter-u14b.h"
-#include "gui_font_ter-u18b.h"
-#include "gui_font_ter-u24b.h"
+#include "gui_font.h"
+#include "gui_layout.h"
+#include "blit.h"
 #include "perf.h"
 #include "oc.h"
 #include "profile.h"
+#include "capture.h"
+#include "session.h"
+#include "thermal.h"
+#include "autotune.h"
 
 // allow both cross and circle button to confirm
 #define BTN_CONFIRM (SCE_CTRL_CROSS | SCE_CTRL_CIRCLE)
 
 int vsnprintf(char *s, size_t n, const char *format, va_list arg);
-
-static SceDisplayFrameBuf g_gui_fb = {
-    .width  = 960,
-    .height = 544,
-    .pitch  = 960,
-};
-static int g_gui_fb_last_width = 960;
-static float g_gui_fb_w_ratio = 1.0f;
-static float g_gui_fb_h_ratio = 1.0f;
-
-static rgba_t *g_gui_buffer;
+SceUInt32 ksceKernelGetProcessTimeLowCore();
+
+static SceDisplayFrameBuf g_gui_fb = {0}; // no fb seen yet
+static const psvs_gui_layout_t *g_gui_layout = &GUI_LAYOUTS[GUI_LAYOUTS_N - 1];
+static const psvs_gui_layout_t *g_gui_layout_last = &GUI_LAYOUTS[GUI_LAYOUTS_N - 1];
+static int g_gui_full_x = 0; // FULL panel position on fb
+static int g_gui_full_y = 0;
+static const psvs_blit_ops_t *g_gui_blit = NULL;
+static uint32_t g_gui_dd_color = 0; // FPS_COLOR packed for fb pixelformat
+
+// Double buffered: psvs_thread draws into back buffer (g_gui_buffer),
+// display hook copies from front buffer, see psvs_gui_flip()
+static uint8_t *g_gui_buffers[2]; // palette indexes
+static uint8_t *g_gui_buffer;
 static SceUID g_gui_buffer_uid = -1;
-
-static const unsigned char *g_gui_font = FONT_TER_U24B;
-static unsigned char g_gui_font_width  = 12;
-static unsigned char g_gui_font_height = 24;
-
-static float g_gui_font_scale = 1.0f;
-static rgba_t g_gui_color_text = {.rgba = {255, 255, 255, 255}};
-static rgba_t g_gui_color_bg   = {.rgba = {  0,   0,   0, 255}};
+static int g_gui_buffer_front = 0;
+static int g_gui_buffer_reading = -1;        // front buffer being copied by hook
+static bool g_gui_dirty_rows[GUI_HEIGHT];    // rows drawn since last flip
+static bool g_gui_dirty = false;
+
+static const psvs_gui_font_t *g_gui_font = &FONT_TER_U24B;
+
+// Glyphs as per-row pixel masks, one atlas per text scale
+typedef enum {
+    GUI_ATLAS_SCALE_HALF, // 0.5x
+    GUI_ATLAS_SCALE_FULL, // 1.0x
+    GUI_ATLAS_SCALE_MAX
+} psvs_gui_atlas_scale_t;
+
+typedef struct {
+    const uint16_t *rows; // [GUI_FONT_GLYPHS][height], bit n set => px at column n
+    unsigned char width;
+    unsigned char height;
+    unsigned char advance2; // distance between glyphs, in half-pixels
+} psvs_gui_atlas_t;
+
+static psvs_gui_atlas_t g_gui_atlas[GUI_ATLAS_SCALE_MAX];
+static uint16_t g_gui_atlas_half_rows[GUI_FONT_GLYPHS * ((GUI_FONT_H + 1) / 2)];
+static const psvs_gui_font_t *g_gui_atlas_font = NULL;
+static psvs_gui_atlas_t *g_gui_atlas_cur = &g_gui_atlas[GUI_ATLAS_SCALE_FULL];
+
+// FPS/battery direct draw glyphs, pre-split into runs of set px
+#define GUI_DD_SPRITE_CHARS   "0123456789%"
+#define GUI_DD_SPRITE_N       11
+#define GUI_DD_SPRITE_PERCENT 10
+#define GUI_DD_SPRITE_MAX_SPANS (GUI_FONT_H * ((GUI_FONT_W + 1) / 2))
+
+typedef struct {
+    psvs_blit_span_t spans[GUI_DD_SPRITE_MAX_SPANS];
+    int span_n;
+} psvs_gui_sprite_t;
+
+static psvs_gui_sprite_t g_gui_dd_sprites[GUI_DD_SPRITE_N];
+static SceUInt32 g_gui_dd_time_fps = 0;  // us
+static SceUInt32 g_gui_dd_time_batt = 0; // us
+
+// Palette of the GUI buffers, append only so published indexes stay valid
+#define GUI_PALETTE_N 256
+static rgba_t g_gui_palette[GUI_PALETTE_N];
+static int g_gui_palette_n = 0;
+static uint32_t g_gui_palette_packed[GUI_PALETTE_N]; // for fb pixelformat, hook side
+static int g_gui_palette_packed_n = 0;
+static const psvs_blit_ops_t *g_gui_palette_packed_blit = NULL;
+static rgba_t g_gui_cpy_row[GUI_WIDTH]; // expanded row for blending, hook side
+
+static uint8_t g_gui_color_text = 0; // palette indexes
+static uint8_t g_gui_color_bg   = 0;
 
 static uint32_t g_gui_input_buttons = 0;
 
 static psvs_gui_menu_control_t g_gui_menu_control = PSVS_GUI_MENUCTRL_CPU;
 static psvs_gui_mode_t g_gui_mode = PSVS_GUI_MODE_HIDDEN;
 static bool g_gui_mode_changed = false;
+static bool g_gui_translucent = false;
+static SceUInt32 g_gui_cpy_time = 0; // us
+
+// Retained widgets, each remembers the value it was last drawn with
+typedef enum {
+    // FULL
+    PSVS_GUI_WIDGET_TITLEID,
+    PSVS_GUI_WIDGET_CPY_TIME,
+    PSVS_GUI_WIDGET_DD_TIME,
+    PSVS_GUI_WIDGET_FRAMES,
+    PSVS_GUI_WIDGET_CAPTURE,
+    PSVS_GUI_WIDGET_THERMAL,
+    PSVS_GUI_WIDGET_BATT,
+    PSVS_GUI_WIDGET_CPU_LOAD, // 4 cores
+    PSVS_GUI_WIDGET_CPU_PEAK = PSVS_GUI_WIDGET_CPU_LOAD + 4,
+    PSVS_GUI_WIDGET_CPU_RATES,
+    PSVS_GUI_WIDGET_CPU_LOAD_AVG,
+    PSVS_GUI_WIDGET_MEM, // MEM, VMEM, PHY
+    PSVS_GUI_WIDGET_MEM_PEAK = PSVS_GUI_WIDGET_MEM + 3,
+    PSVS_GUI_WIDGET_MENU, // per menuctrl
+    PSVS_GUI_WIDGET_GRAPH_SECTION = PSVS_GUI_WIDGET_MENU + PSVS_GUI_MENUCTRL_MAX, // graph or session
+    PSVS_GUI_WIDGET_GRAPH,
+    PSVS_GUI_WIDGET_FRAMETIME_STATS,
+    PSVS_GUI_WIDGET_SESSION,
+    // OSD
+    PSVS_GUI_WIDGET_OSD_CPU_LOAD,
+    PSVS_GUI_WIDGET_OSD_CPU_PEAK = PSVS_GUI_WIDGET_OSD_CPU_LOAD + 4,
+    PSVS_GUI_WIDGET_OSD_FPS,
+    PSVS_GUI_WIDGET_OSD_BATT,
+    PSVS_GUI_WIDGET_OSD_GRAPH,
+    PSVS_GUI_WIDGET_OSD_STUTTER,
+    PSVS_GUI_WIDGET_OSD_CPU_RATES,
+    PSVS_GUI_WIDGET_MAX
+} psvs_gui_widget_t;
+
+typedef struct {
+    uint32_t value;
+    bool valid;
+} psvs_gui_widget_state_t;
+
+static psvs_gui_widget_state_t g_gui_widgets[PSVS_GUI_WIDGET_MAX];
+
+#define GUI_HASH_INIT 2166136261u
+#define GUI_HASH(h, v) (((h) ^ (uint32_t)(v)) * 16777619u)
 
-static bool g_gui_lazydraw_batt = false;
-static bool g_gui_lazydraw_memusage = false;
-
-#define GUI_CORNERS_XD_RADIUS 9
-static const unsigned char GUI_CORNERS_XD[GUI_CORNERS_XD_RADIUS] = {9, 7, 5, 4, 3, 2, 2, 1, 1};
 
 static const rgba_t WHITE = {.rgba = {.r = 255, .g = 255, .b = 255, .a = 255}};
 static const rgba_t BLACK = {.rgba = {.r = 0, .g = 0, .b = 0, .a = 255}};
 static const rgba_t FPS_COLOR = {.rgba = {.r = 0, .g = 255, .b = 0, .a = 255}};
+static const rgba_t GRAPH_GRID_COLOR = {.rgba = {.r = 80, .g = 80, .b = 80, .a = 255}};
+
+// Frame-time graph scale, in us
+#define GUI_GRAPH_FRAMETIME_MIN 16667 // 60 FPS, green
+#define GUI_GRAPH_FRAMETIME_MAX 50000 // 20 FPS, red, top of graph
 
 psvs_gui_mode_t psvs_gui_get_mode() {
     return g_gui_mode;
 }
 
+int psvs_gui_get_cpy_time() {
+    return g_gui_cpy_time;
+}
+
+int psvs_gui_get_dd_time() {
+    int time = 0;
+    if (g_gui_mode == PSVS_GUI_MODE_FPS || g_gui_mode == PSVS_GUI_MODE_FULL || g_gui_mode == PSVS_GUI_MODE_FPS_BATTERY)
+        time += g_gui_dd_time_fps;
+    if (g_gui_mode == PSVS_GUI_MODE_BATTERY || g_gui_mode == PSVS_GUI_MODE_FULL || g_gui_mode == PSVS_GUI_MODE_FPS_BATTERY)
+        time += g_gui_dd_time_batt;
+    return time;
+}
+
 static psvs_oc_device_t _psvs_gui_get_device_from_menuctrl(psvs_gui_menu_control_t ctrl) {
     switch (ctrl) {
         case PSVS_GUI_MENUCTRL_CPU:      return PSVS_OC_DEVICE_CPU;
@@ -87,6 +196,14 @@ void psvs_gui_input_check(uint32_t buttons) {
         } else if (buttons_new & SCE_CTRL_DOWN && g_gui_mode > 0) {
             g_gui_mode--; // Hide
             g_gui_mode_changed = true;
+        } else if (buttons_new & (SCE_CTRL_LEFT | SCE_CTRL_RIGHT)) {
+            g_gui_translucent = !g_gui_translucent;
+            g_gui_mode_changed = true; // redraw template with new bg alpha
+        } else if (buttons_new & SCE_CTRL_TRIANGLE) {
+            if (!psvs_capture_start())
+                psvs_capture_stop();
+        } else if (buttons_new & SCE_CTRL_SQUARE) {
+            psvs_session_toggle();
         }
     }
     // In full menu
@@ -98,8 +215,17 @@ void psvs_gui_input_check(uint32_t buttons) {
             g_gui_menu_control--;
         }
 
+        // Auto-tune label, start/cancel/dismiss
+        if (g_gui_menu_control == PSVS_GUI_MENUCTRL_AUTOTUNE) {
+            if (buttons_new & BTN_CONFIRM)
+                psvs_autotune_toggle();
+        }
+        // Clocks and profile belong to auto-tune while it runs
+        else if (psvs_autotune_is_running()) {
+            ;
+        }
         // Profile label
-        if (g_gui_menu_control == PSVS_GUI_MENUCTRL_PROFILE) {
+        else if (g_gui_menu_control == PSVS_GUI_MENUCTRL_PROFILE) {
             if (buttons_new & BTN_CONFIRM) {
                 bool global = buttons & GUI_GLOBAL_PROFILE_BUTTON_MOD;
                 if ((!global && psvs_oc_has_changed()) || !psvs_profile_exists(global)) {
@@ -121,6 +247,20 @@ void psvs_gui_input_check(uint32_t buttons) {
                 } else if (buttons_new & SCE_CTRL_LEFT) {
                     psvs_oc_change_manual(device, false);
                 }
+                // On to governor, back to default for Venezia
+                else if (buttons_new & BTN_CONFIRM) {
+                    psvs_oc_set_mode(device, device == PSVS_OC_DEVICE_VENEZIA
+                                     ? PSVS_OC_MODE_DEFAULT : PSVS_OC_MODE_GOVERNOR);
+                }
+            }
+            // In governor mode
+            else if (psvs_oc_get_mode(device) == PSVS_OC_MODE_GOVERNOR) {
+                // Change target FPS L/R
+                if (buttons_new & SCE_CTRL_RIGHT) {
+                    psvs_oc_change_target_fps(true);
+                } else if (buttons_new & SCE_CTRL_LEFT) {
+                    psvs_oc_change_target_fps(false);
+                }
                 // Back to default
                 else if (buttons_new & BTN_CONFIRM) {
                     psvs_oc_set_mode(device, PSVS_OC_MODE_DEFAULT);
@@ -139,174 +279,279 @@ void psvs_gui_input_check(uint32_t buttons) {
     g_gui_input_buttons = buttons;
 }
 
-void psvs_gui_set_framebuf(const SceDisplayFrameBuf *pParam) {
-    memcpy(&g_gui_fb, pParam, sizeof(SceDisplayFrameBuf));
+static inline const uint16_t *_psvs_gui_atlas_glyph(const psvs_gui_atlas_t *atlas, char character) {
+    return &atlas->rows[GUI_FONT_REMAP[(unsigned char)character] * atlas->height];
+}
 
-    g_gui_fb_w_ratio = pParam->width / 960.0f;
-    g_gui_fb_h_ratio = pParam->height / 544.0f;
-
-    // Set appropriate font
-    if (pParam->width <= 640) {
-        // 640x368 - Terminus 8x14 Bold
-        g_gui_font = FONT_TER_U14B;
-        g_gui_font_width = 8;
-        g_gui_font_height = 14;
-    } else if (pParam->width <= 720) {
-        // 720x408 - Terminus 10x18 Bold
-        g_gui_font = FONT_TER_U18B;
-        g_gui_font_width = 9; // <- trim last col, better scaling
-        g_gui_font_height = 18;
-    } else {
-        // 960x544 or more - Terminus 12x24 Bold
-        g_gui_font = FONT_TER_U24B;
-        g_gui_font_width = 12;
-        g_gui_font_height = 24;
+static void _psvs_gui_build_atlas_half() {
+    psvs_gui_atlas_t *atlas = &g_gui_atlas[GUI_ATLAS_SCALE_HALF];
+
+    atlas->rows = g_gui_atlas_half_rows;
+    atlas->width = (g_gui_font->width + 1) >> 1;
+    atlas->height = (g_gui_font->height + 1) >> 1;
+    atlas->advance2 = g_gui_font->width;
+
+    for (int c = 0; c < GUI_FONT_GLYPHS; c++) {
+        psvs_blit_glyph_half(&g_gui_atlas_half_rows[c * atlas->height],
+                             &g_gui_font->rows[c * g_gui_font->height],
+                             g_gui_font->width, g_gui_font->height);
     }
 }
 
-bool psvs_gui_fb_res_changed() {
-    bool changed = g_gui_fb_last_width != g_gui_fb.width;
-    if (changed) {
-        g_gui_lazydraw_batt = true;
-        g_gui_lazydraw_memusage = true;
+static void _psvs_gui_build_dd_sprites() {
+    const psvs_gui_atlas_t *atlas = &g_gui_atlas[GUI_ATLAS_SCALE_FULL];
+
+    for (int i = 0; i < GUI_DD_SPRITE_N; i++) {
+        psvs_gui_sprite_t *spr = &g_gui_dd_sprites[i];
+        const uint16_t *rows = _psvs_gui_atlas_glyph(atlas, GUI_DD_SPRITE_CHARS[i]);
+        spr->span_n = psvs_blit_glyph_spans(spr->spans, rows, atlas->width, atlas->height);
+    }
+}
+
+static void _psvs_gui_build_atlas() {
+    // Full size glyphs are used straight from the font
+    psvs_gui_atlas_t *full = &g_gui_atlas[GUI_ATLAS_SCALE_FULL];
+    full->rows = g_gui_font->rows;
+    full->width = g_gui_font->width;
+    full->height = g_gui_font->height;
+    full->advance2 = g_gui_font->width * 2;
+
+    _psvs_gui_build_atlas_half();
+    _psvs_gui_build_dd_sprites();
+    g_gui_atlas_font = g_gui_font;
+}
+
+bool psvs_gui_set_framebuf(const SceDisplayFrameBuf *pParam) {
+    // Pick kernels once per pixelformat change
+    if (!g_gui_blit || g_gui_blit->pixelformat != pParam->pixelformat) {
+        g_gui_blit = psvs_blit_get_ops(pParam->pixelformat);
+        if (!g_gui_blit)
+            return false; // unsupported pixelformat
+        g_gui_dd_color = g_gui_blit->pack(FPS_COLOR);
     }
 
-    g_gui_fb_last_width = g_gui_fb.width;
+    if (g_gui_fb.width != pParam->width || g_gui_fb.height != pParam->height) {
+        // Pick the largest layout that fits, tables are sorted by size
+        const psvs_gui_layout_t *layout = &GUI_LAYOUTS[0];
+        for (int i = 1; i < GUI_LAYOUTS_N; i++) {
+            if (GUI_LAYOUTS[i].width <= pParam->width && GUI_LAYOUTS[i].height <= pParam->height)
+                layout = &GUI_LAYOUTS[i];
+        }
+
+        if (layout->full_w > pParam->width || layout->full_h > pParam->height)
+            return false; // fb too small
+
+        g_gui_full_x = (pParam->width / 2) - (layout->full_w / 2);
+        g_gui_full_y = (pParam->height / 2) - (layout->full_h / 2);
+
+        g_gui_font = layout->font;
+        g_gui_layout = layout;
+    }
+
+    memcpy(&g_gui_fb, pParam, sizeof(SceDisplayFrameBuf));
+
+    if (g_gui_atlas_font != g_gui_font)
+        _psvs_gui_build_atlas();
+
+    return true;
+}
+
+// Returns true if widget has to be redrawn to show value
+static bool _psvs_gui_widget_update(psvs_gui_widget_t widget, uint32_t value) {
+    psvs_gui_widget_state_t *state = &g_gui_widgets[widget];
+    if (state->valid && state->value == value)
+        return false;
+
+    state->value = value;
+    state->valid = true;
+    return true;
+}
+
+static void _psvs_gui_widget_invalidate_all() {
+    for (int i = 0; i < PSVS_GUI_WIDGET_MAX; i++)
+        g_gui_widgets[i].valid = false;
+}
+
+bool psvs_gui_fb_res_changed() {
+    bool changed = g_gui_layout_last != g_gui_layout;
+    if (changed)
+        _psvs_gui_widget_invalidate_all();
+
+    g_gui_layout_last = g_gui_layout;
     return changed;
 }
 
 bool psvs_gui_mode_changed() {
     bool changed = g_gui_mode_changed;
-    if (changed) {
-        g_gui_lazydraw_batt = true;
-        g_gui_lazydraw_memusage = true;
-    }
+    if (changed)
+        _psvs_gui_widget_invalidate_all();
 
     g_gui_mode_changed = false;
     return changed;
 }
 
+static uint8_t _psvs_gui_palette_index(rgba_t color) {
+    for (int i = 0; i < g_gui_palette_n; i++) {
+        if (g_gui_palette[i].uint32 == color.uint32)
+            return i;
+    }
+
+    if (g_gui_palette_n < GUI_PALETTE_N) {
+        g_gui_palette[g_gui_palette_n] = color;
+        __atomic_store_n(&g_gui_palette_n, g_gui_palette_n + 1, __ATOMIC_RELEASE);
+        return g_gui_palette_n - 1;
+    }
+
+    // Palette is full, fall back to the closest color
+    int best = 0, best_dist = 0x7FFFFFFF;
+    for (int i = 0; i < GUI_PALETTE_N; i++) {
+        int dist = abs(g_gui_palette[i].rgba.r - color.rgba.r)
+                + abs(g_gui_palette[i].rgba.g - color.rgba.g)
+                + abs(g_gui_palette[i].rgba.b - color.rgba.b)
+                + abs(g_gui_palette[i].rgba.a - color.rgba.a);
+        if (dist < best_dist) {
+            best = i;
+            best_dist = dist;
+        }
+    }
+
+    return best;
+}
+
 void psvs_gui_set_back_color(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    g_gui_color_bg.rgba.r = r;
-    g_gui_color_bg.rgba.g = g;
-    g_gui_color_bg.rgba.b = b;
-    g_gui_color_bg.rgba.a = a;
+    rgba_t color = {.rgba = {.r = r, .g = g, .b = b, .a = a}};
+    g_gui_color_bg = _psvs_gui_palette_index(color);
 }
 
 void psvs_gui_set_text_color(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    g_gui_color_text.rgba.r = r;
-    g_gui_color_text.rgba.g = g;
-    g_gui_color_text.rgba.b = b;
-    g_gui_color_text.rgba.a = a;
+    rgba_t color = {.rgba = {.r = r, .g = g, .b = b, .a = a}};
+    g_gui_color_text = _psvs_gui_palette_index(color);
 }
 
 void psvs_gui_set_text_color2(rgba_t color) {
-    g_gui_color_text = color;
+    g_gui_color_text = _psvs_gui_palette_index(color);
 }
 
 void psvs_gui_set_text_scale(float scale) {
-    g_gui_font_scale = scale;
+    g_gui_atlas_cur = &g_gui_atlas[scale < 1.0f ? GUI_ATLAS_SCALE_HALF : GUI_ATLAS_SCALE_FULL];
 }
 
-static void _psvs_gui_dd_prchar(const char character, int x, int y) {
-    for (int yy = 0; yy < g_gui_font_height * g_gui_font_scale; yy++) {
-        int yy_font = yy / g_gui_font_scale;
-
-        uint32_t displacement = x + (y + yy) * g_gui_fb.pitch;
-        if (displacement >= g_gui_fb.pitch * g_gui_fb.height)
-            return; // out of bounds
+static void _psvs_gui_dd_sprite(int sprite, int x, int y) {
+    const psvs_gui_sprite_t *spr = &g_gui_dd_sprites[sprite];
 
-        rgba_t *px = (rgba_t *)g_gui_fb.base + displacement;
+    // Sprites are drawn either whole or not at all
+    if (x < 0 || y < 0
+            || x + g_gui_atlas[GUI_ATLAS_SCALE_FULL].width > g_gui_fb.width
+            || y + g_gui_atlas[GUI_ATLAS_SCALE_FULL].height > g_gui_fb.height)
+        return; // out of bounds
 
-        for (int xx = 0; xx < g_gui_font_width * g_gui_font_scale; xx++) {
-            if (x + xx >= g_gui_fb.width)
-                return; // out of bounds
+    uint32_t color = g_gui_dd_color;
+    uint32_t *base = (uint32_t *)g_gui_fb.base + x + y * g_gui_fb.pitch;
 
-            // Get px 0/1 from osd_font.h
-            int xx_font = xx / g_gui_font_scale;
-            uint32_t charPos = character * (g_gui_font_height * (((g_gui_font_width - 1) / 8) + 1));
-            uint32_t charPosH = charPos + (yy_font * (((g_gui_font_width - 1) / 8) + 1));
-            uint8_t charByte = g_gui_font[charPosH + (xx_font / 8)];
+    for (int i = 0; i < spr->span_n; i++) {
+        uint32_t *px = base + spr->spans[i].y * g_gui_fb.pitch + spr->spans[i].x;
+        for (int xx = 0; xx < spr->spans[i].len; xx++)
+            px[xx] = color;
+    }
+}
 
-            if ((charByte >> (7 - (xx_font % 8))) & 1) {
-                *(px + xx) = FPS_COLOR;
-            }
-        }
+// Split value into sprite indexes, most significant digit first
+static int _psvs_gui_dd_digits(int value, int *sprites, int max_n) {
+    int n = 0;
+    if (value < 0)
+        value = 0;
+
+    do {
+        sprites[n++] = value % 10;
+        value /= 10;
+    } while (value && n < max_n);
+
+    for (int i = 0; i < n / 2; i++) {
+        int tmp = sprites[i];
+        sprites[i] = sprites[n - i - 1];
+        sprites[n - i - 1] = tmp;
     }
+
+    return n;
 }
 
 void psvs_gui_dd_fps() {
-    char buf[4] = "";
-    snprintf(buf, 4, "%d", psvs_perf_get_fps());
-    size_t len = strlen(buf);
+    SceUInt32 tick_start = ksceKernelGetProcessTimeLowCore();
+
+    int sprites[3];
+    int n = _psvs_gui_dd_digits(psvs_perf_get_fps(), sprites, 3);
 
     uint32_t dacr;
     DACR_UNRESTRICT(dacr);
 
-    for (int i = 0; i < len; i++) {
-        _psvs_gui_dd_prchar(buf[i], 10 + i * g_gui_font_width * g_gui_font_scale, 10);
+    for (int i = 0; i < n; i++) {
+        _psvs_gui_dd_sprite(sprites[i], 10 + i * g_gui_font->width, 10);
     }
 
     DACR_RESET(dacr);
+
+    g_gui_dd_time_fps = ksceKernelGetProcessTimeLowCore() - tick_start;
 }
 
 void psvs_gui_dd_battery() {
-    char buf[6] = "";
-    snprintf(buf, 6, "%d%%", psvs_perf_get_batt()->percent);
-    size_t len = strlen(buf);
+    SceUInt32 tick_start = ksceKernelGetProcessTimeLowCore();
+
+    int sprites[4];
+    int n = _psvs_gui_dd_digits(psvs_perf_get_batt()->percent, sprites, 3);
+    sprites[n++] = GUI_DD_SPRITE_PERCENT;
 
     uint32_t dacr;
     DACR_UNRESTRICT(dacr);
 
-    for (int i = 1; i <= len; i++) {
-        _psvs_gui_dd_prchar(buf[len - i],
-                            g_gui_fb.width - 10 - i * g_gui_font_width * g_gui_font_scale, 10);
+    for (int i = 1; i <= n; i++) {
+        _psvs_gui_dd_sprite(sprites[n - i], g_gui_fb.width - 10 - i * g_gui_font->width, 10);
     }
 
     DACR_RESET(dacr);
-}
 
-void psvs_gui_clear() {
-    for (int i = 0; i < GUI_WIDTH * GUI_HEIGHT; i++)
-        g_gui_buffer[i] = g_gui_color_bg;
+    g_gui_dd_time_batt = ksceKernelGetProcessTimeLowCore() - tick_start;
 }
 
-static void _psvs_gui_prchar(const char character, int x, int y) {
-    // Draw spaces faster
-    if (character == ' ') {
-        for (int yy = 0; yy < g_gui_font_height * g_gui_font_scale; yy++) {
-            rgba_t *buf = &g_gui_buffer[((y + yy) * GUI_WIDTH) + x];
-            for (int xx = 0; xx < g_gui_font_width * g_gui_font_scale; xx++) {
-                buf[xx] = g_gui_color_bg;
-            }
-        }
-
+static void _psvs_gui_mark_dirty(int y, int h) {
+    if (y < 0)
+        y = 0;
+    if (y + h > GUI_HEIGHT)
+        h = GUI_HEIGHT - y;
+    if (h <= 0)
         return;
-    }
-
-    // TODO: rewrite
-    for (int yy = 0; yy < g_gui_font_height * g_gui_font_scale; yy++) {
-        int yy_font = yy / g_gui_font_scale;
 
-        uint32_t displacement = x + (y + yy) * GUI_WIDTH;
-        if (displacement >= GUI_WIDTH * GUI_HEIGHT)
-            return; // out of bounds
+    memset(&g_gui_dirty_rows[y], true, h);
+    g_gui_dirty = true;
+}
 
-        rgba_t *px = (rgba_t *)g_gui_buffer + displacement;
+void psvs_gui_clear() {
+    _psvs_gui_mark_dirty(0, GUI_HEIGHT);
+    memset(g_gui_buffer, g_gui_color_bg, GUI_WIDTH * GUI_HEIGHT);
+}
 
-        for (int xx = 0; xx < g_gui_font_width * g_gui_font_scale; xx++) {
-            if (x + xx >= GUI_WIDTH)
-                return; // out of bounds
+static void _psvs_gui_prchar(const char character, int x, int y) {
+    const psvs_gui_atlas_t *atlas = g_gui_atlas_cur;
+    const uint16_t *rows = _psvs_gui_atlas_glyph(atlas, character);
+
+    int w = atlas->width;
+    int h = atlas->height;
+    if (x + w > GUI_WIDTH)
+        w = GUI_WIDTH - x; // out of bounds
+    if (y + h > GUI_HEIGHT)
+        h = GUI_HEIGHT - y; // out of bounds
+    if (x < 0 || y < 0 || w <= 0 || h <= 0)
+        return;
 
-            // Get px 0/1 from osd_font.h
-            int xx_font = xx / g_gui_font_scale;
-            uint32_t charPos = character * (g_gui_font_height * (((g_gui_font_width - 1) / 8) + 1));
-            uint32_t charPosH = charPos + (yy_font * (((g_gui_font_width - 1) / 8) + 1));
-            uint8_t charByte = g_gui_font[charPosH + (xx_font / 8)];
+    uint8_t bg = g_gui_color_bg;
+    uint8_t diff = g_gui_color_text ^ bg;
+    _psvs_gui_mark_dirty(y, h);
+    uint8_t *px = &g_gui_buffer[y * GUI_WIDTH + x];
 
-            rgba_t color = ((charByte >> (7 - (xx_font % 8))) & 1) ? g_gui_color_text : g_gui_color_bg;
-            *(px + xx) = color;
-        }
+    for (int yy = 0; yy < h; yy++, px += GUI_WIDTH) {
+        // Select text/bg color per px without branching
+        uint32_t mask = rows[yy];
+        for (int xx = 0; xx < w; xx++, mask >>= 1)
+            px[xx] = bg ^ (diff & -(mask & 1));
     }
 }
 
@@ -316,7 +561,7 @@ void psvs_gui_print(int x, int y, const char *str) {
 
     size_t len = strlen(str);
     for (size_t i = 0; i < len; i++) {
-        _psvs_gui_prchar(str[i], x + i * g_gui_font_width * g_gui_font_scale, y);
+        _psvs_gui_prchar(str[i], x + ((i * g_gui_atlas_cur->advance2) >> 1), y);
     }
 }
 
@@ -357,6 +602,11 @@ rgba_t psvs_gui_scale_color(int value, int min, int max) {
 
     int v = ((float)(value - min) / (max - min)) * 255; // 0-255
 
+    // Quantize to 65 steps, keeps the palette small
+    v = (v + 2) & ~3;
+    if (v > 255)
+        v = 255;
+
     rgba_t color;
     color.rgba.r = (v <= 127) ? v * 2 : 255;
     color.rgba.g = (v > 127) ? 255 - ((v - 128) * 2) : 255;
@@ -372,29 +622,31 @@ static void _psvs_gui_draw_battery_template(int x, int y) {
     int w = GUI_RESCALE_X(GUI_BATT_SIZE_W);
     int h = GUI_RESCALE_Y(GUI_BATT_SIZE_H);
 
-    rgba_t *px = (rgba_t *)g_gui_buffer + (y * GUI_WIDTH) + x;
+    _psvs_gui_mark_dirty(y, h + 1);
+    uint8_t *px = g_gui_buffer + (y * GUI_WIDTH) + x;
+    uint8_t white = _psvs_gui_palette_index(WHITE);
     int xx, yy;
 
     for (xx = 0; xx < w; xx++) {
         // top
         *(px + xx)
-            = *(px + GUI_WIDTH + xx) = WHITE;
+            = *(px + GUI_WIDTH + xx) = white;
         // bottom
         *(px + (h * GUI_WIDTH) + xx)
-            = *(px + ((h - 1) * GUI_WIDTH) + xx) = WHITE;
+            = *(px + ((h - 1) * GUI_WIDTH) + xx) = white;
     }
 
     for (yy = 0; yy < h; yy++) {
         // left
         *(px + (yy * GUI_WIDTH))
-            = *(px + (yy * GUI_WIDTH) + 1) = WHITE;
+            = *(px + (yy * GUI_WIDTH) + 1) = white;
         // right
         if (yy < h / 3 || yy > h - (h / 3)) {
             *(px + (yy * GUI_WIDTH) + (w - 1))
-                = *(px + (yy * GUI_WIDTH) + (w - 2)) = WHITE;
+                = *(px + (yy * GUI_WIDTH) + (w - 2)) = white;
         } else {
             *(px + (yy * GUI_WIDTH) + (w - 1) + (h / 5))
-                = *(px + (yy * GUI_WIDTH) + (w - 2) + (h / 5)) = WHITE;
+                = *(px + (yy * GUI_WIDTH) + (w - 2) + (h / 5)) = white;
         }
     }
 
@@ -402,20 +654,24 @@ static void _psvs_gui_draw_battery_template(int x, int y) {
     for (xx = 0; xx < (h / 5) + 2; xx++) {
         // top
         *(px + (GUI_WIDTH * (h / 3 - 1)) + (w - 2) + xx)
-            = *(px + (GUI_WIDTH * (h / 3)) + (w - 2) + xx) = WHITE;
+            = *(px + (GUI_WIDTH * (h / 3)) + (w - 2) + xx) = white;
         // bottom
         *(px + (GUI_WIDTH * (h - (h / 3))) + (w - 2) + xx)
-            = *(px + (GUI_WIDTH * (h - (h / 3) + 1)) + (w - 2) + xx) = WHITE;
+            = *(px + (GUI_WIDTH * (h - (h / 3) + 1)) + (w - 2) + xx) = white;
     }
 }
 
-static void _psvs_gui_draw_battery(int x, int y, int state, bool is_charging, rgba_t color) {
+static void _psvs_gui_draw_battery(int x, int y, int state, bool is_charging, rgba_t rgba) {
     x = GUI_RESCALE_X(x);
     y = GUI_RESCALE_Y(y);
     int w = GUI_RESCALE_X(GUI_BATT_SIZE_W);
     int h = GUI_RESCALE_Y(GUI_BATT_SIZE_H);
 
-    rgba_t *px = (rgba_t *)g_gui_buffer + (y * GUI_WIDTH) + x;
+    _psvs_gui_mark_dirty(y, h + 1);
+    uint8_t *px = g_gui_buffer + (y * GUI_WIDTH) + x;
+    uint8_t white = _psvs_gui_palette_index(WHITE);
+    uint8_t black = _psvs_gui_palette_index(BLACK);
+    uint8_t color = _psvs_gui_palette_index(rgba);
     int state_x = state > 95 ? w : (state * (w - 4) / 95) + 1;
     int xx, yy;
 
@@ -424,7 +680,7 @@ static void _psvs_gui_draw_battery(int x, int y, int state, bool is_charging, rg
             if (xx <= state_x) {
                 *(px + (GUI_WIDTH * yy) + xx) = color;
             } else {
-                *(px + (GUI_WIDTH * yy) + xx) = BLACK;
+                *(px + (GUI_WIDTH * yy) + xx) = black;
             }
         }
     }
@@ -435,21 +691,21 @@ static void _psvs_gui_draw_battery(int x, int y, int state, bool is_charging, rg
             if (state > 95) {
                 *(px + (GUI_WIDTH * ((h / 3 - 1) + yy)) + w + xx - 2) = color;
             } else {
-                *(px + (GUI_WIDTH * ((h / 3 - 1) + yy)) + w + xx - 2) = BLACK;
+                *(px + (GUI_WIDTH * ((h / 3 - 1) + yy)) + w + xx - 2) = black;
             }
         }
     }
 
     if (is_charging) {
         for (xx = 0; xx < (h / 3); xx++)
-            *(px + (GUI_WIDTH * (h / 2)) + (w / 5) + xx) = WHITE;
+            *(px + (GUI_WIDTH * (h / 2)) + (w / 5) + xx) = white;
         for (yy = 0; yy < (h / 3); yy++)
-            *(px + (GUI_WIDTH * ((h / 3) + yy + 1)) + (w / 5) + (h / 6)) = WHITE;
+            *(px + (GUI_WIDTH * ((h / 3) + yy + 1)) + (w / 5) + (h / 6)) = white;
     }
 }
 
 void psvs_gui_draw_osd_template() {
-    psvs_gui_set_back_color(0, 0, 0, 255);
+    psvs_gui_set_back_color(0, 0, 0, g_gui_translucent ? GUI_TRANSLUCENT_ALPHA : 255);
     psvs_gui_set_text_color(255, 255, 255, 255);
     psvs_gui_clear();
 
@@ -472,26 +728,28 @@ void psvs_gui_draw_osd_cpu() {
     // Draw AVG load
     for (int i = 0; i < 4; i++) {
         val = psvs_perf_get_load(i);
+        if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_OSD_CPU_LOAD + i, val))
+            continue;
         psvs_gui_set_text_color2(psvs_gui_scale_color(val, 0, 100));
         psvs_gui_printf(GUI_ANCHOR_RX(10, 19 - i * 5), GUI_ANCHOR_TY(8, 0), "%3d", val);
     }
 
     // Draw peak load
     val = psvs_perf_get_peak();
-    psvs_gui_set_text_color2(psvs_gui_scale_color(val, 0, 100));
-    psvs_gui_printf(GUI_ANCHOR_LX(10, 7), GUI_ANCHOR_TY(10, 1), "%3d", val);
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_OSD_CPU_PEAK, val)) {
+        psvs_gui_set_text_color2(psvs_gui_scale_color(val, 0, 100));
+        psvs_gui_printf(GUI_ANCHOR_LX(10, 7), GUI_ANCHOR_TY(10, 1), "%3d", val);
+    }
 
     psvs_gui_set_text_color(255, 255, 255, 255);
 }
 
 void psvs_gui_draw_osd_batt() {
     psvs_battery_t *batt = psvs_perf_get_batt();
-    if (!batt->_has_changed && !g_gui_lazydraw_batt)
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_OSD_BATT,
+                GUI_HASH(GUI_HASH(GUI_HASH_INIT, batt->percent), batt->is_charging)))
         return;
 
-    batt->_has_changed = false;
-    g_gui_lazydraw_batt = false;
-
     // Draw battery percentage
     rgba_t color = psvs_gui_scale_color(60 - batt->percent, 0, 100);
     psvs_gui_set_text_color2(color);
@@ -508,6 +766,8 @@ void psvs_gui_draw_osd_batt() {
 
 void psvs_gui_draw_osd_fps() {
     int fps = psvs_perf_get_fps();
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_OSD_FPS, fps))
+        return;
 
     psvs_gui_set_text_color2(psvs_gui_scale_color(30 - fps, 0, 30));
     if (fps > 99)
@@ -518,8 +778,106 @@ void psvs_gui_draw_osd_fps() {
     psvs_gui_set_text_color(255, 255, 255, 255);
 }
 
+// Scrolling frame-time graph, one column per frame, newest on the right,
+// hitches are marked on top. Widget value is the frame count drawn up to,
+// only new frames are drawn.
+static void _psvs_gui_draw_graph(psvs_gui_widget_t widget, int x, int y, int w, int h) {
+    int x0 = GUI_RESCALE_X(x);
+    int y0 = GUI_RESCALE_Y(y);
+    int bw = GUI_RESCALE_X(x + w) - x0;
+    int bh = GUI_RESCALE_Y(y + h) - y0;
+
+    psvs_gui_widget_state_t *state = &g_gui_widgets[widget];
+    uint32_t count = psvs_perf_get_frame_count();
+    uint32_t n = state->valid ? count - state->value : bw;
+    if (n == 0)
+        return;
+    if (n > bw)
+        n = bw;
+
+    state->value = count;
+    state->valid = true;
+
+    _psvs_gui_mark_dirty(y0, bh);
+    uint8_t *px = &g_gui_buffer[y0 * GUI_WIDTH + x0];
+
+    // Scroll older columns out to the left
+    if (n < bw) {
+        for (int yy = 0; yy < bh; yy++)
+            memmove(&px[yy * GUI_WIDTH], &px[yy * GUI_WIDTH + n], bw - n);
+    }
+
+    uint8_t bg = g_gui_color_bg;
+    uint8_t grid = _psvs_gui_palette_index(GRAPH_GRID_COLOR);
+    uint8_t marker = _psvs_gui_palette_index(WHITE);
+    int grid_60 = bh - (GUI_GRAPH_FRAMETIME_MIN * bh) / GUI_GRAPH_FRAMETIME_MAX;
+    int grid_30 = bh - (2 * GUI_GRAPH_FRAMETIME_MIN * bh) / GUI_GRAPH_FRAMETIME_MAX;
+
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t age = n - i; // frames before count
+        uint32_t frametime = 0;
+        bool hitch = false;
+        if (age <= count && age <= PSVS_PERF_FRAMETIME_HISTORY) {
+            frametime = psvs_perf_get_frametime(count - age);
+            hitch = psvs_perf_is_hitch(count - age);
+        }
+
+        int bar = (frametime >= GUI_GRAPH_FRAMETIME_MAX) ? bh : (frametime * bh) / GUI_GRAPH_FRAMETIME_MAX;
+        uint8_t color = _psvs_gui_palette_index(psvs_gui_scale_color(frametime, GUI_GRAPH_FRAMETIME_MIN, GUI_GRAPH_FRAMETIME_MAX));
+        uint8_t *col = &px[bw - n + i];
+
+        for (int yy = 0; yy < bh; yy++) {
+            uint8_t c = bg;
+            if (hitch && yy < 2)
+                c = marker;
+            else if (yy >= bh - bar)
+                c = color;
+            else if (yy == grid_60 || yy == grid_30)
+                c = grid;
+            col[yy * GUI_WIDTH] = c;
+        }
+    }
+}
+
+void psvs_gui_draw_osd_graph() {
+    _psvs_gui_draw_graph(PSVS_GUI_WIDGET_OSD_GRAPH, 10, GUI_ANCHOR_TY(8, 2) + 32, GUI_WIDTH - 20, 22);
+}
+
+void psvs_gui_draw_osd_stutter() {
+    psvs_stutter_t stutter;
+    psvs_perf_get_stutter(&stutter);
+
+    int last = -1; // seconds since last hitch
+    if (stutter.last_hitch)
+        last = (ksceKernelGetProcessTimeLowCore() - stutter.last_hitch) / (1000 * 1000);
+    if (last > 9999)
+        last = 9999;
+
+    int present_fps = psvs_perf_get_present_fps();
+
+    uint32_t hash = GUI_HASH_INIT;
+    hash = GUI_HASH(hash, stutter.hitches_min);
+    hash = GUI_HASH(hash, stutter.missed_min);
+    hash = GUI_HASH(hash, last);
+    hash = GUI_HASH(hash, present_fps);
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_OSD_STUTTER, hash))
+        return;
+
+    psvs_gui_set_text_scale(0.5f);
+    psvs_gui_set_text_color2(psvs_gui_scale_color(stutter.hitches_min, 0, 30));
+    psvs_gui_printf(GUI_ANCHOR_LX(10, 0), GUI_ANCHOR_TY(8, 2) + 6,
+                    "hitch %3d/m  miss %3d/m", stutter.hitches_min, stutter.missed_min);
+    psvs_gui_set_text_color(255, 255, 255, 255);
+    psvs_gui_printf(GUI_ANCHOR_LX(10, 13), GUI_ANCHOR_TY(8, 2) + 6, "pres %3d", present_fps);
+    if (last >= 0)
+        psvs_gui_printf(GUI_ANCHOR_RX2(10, 10, 0.5f), GUI_ANCHOR_TY(8, 2) + 6, "last %4ds", last);
+    else
+        psvs_gui_printf(GUI_ANCHOR_RX2(10, 10, 0.5f), GUI_ANCHOR_TY(8, 2) + 6, "last     -");
+    psvs_gui_set_text_scale(1.0f);
+}
+
 void psvs_gui_draw_template() {
-    psvs_gui_set_back_color(0, 0, 0, 255);
+    psvs_gui_set_back_color(0, 0, 0, g_gui_translucent ? GUI_TRANSLUCENT_ALPHA : 255);
     psvs_gui_set_text_color(255, 255, 255, 255);
     psvs_gui_clear();
 
@@ -546,34 +904,85 @@ void psvs_gui_draw_template() {
     psvs_gui_printf(GUI_ANCHOR_LX(10, 0),  GUI_ANCHOR_TY(56, 5), "PHY:");
 
     // Menu
-    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 6), "CPU [         ]");
-    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 5), "ES4 [         ]");
-    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 4), "BUS [         ]");
-    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 3), "XBR [         ]");
-    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 2), "VNZ [         ]");
+    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 7), "CPU [         ]");
+    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 6), "ES4 [         ]");
+    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 5), "BUS [         ]");
+    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 4), "XBR [         ]");
+    psvs_gui_printf(GUI_ANCHOR_CX(15),     GUI_ANCHOR_BY(10, 3), "VNZ [         ]");
 }
 
 void psvs_gui_draw_header() {
-    // Draw TITLEID
+    uint32_t hash = GUI_HASH_INIT;
+    for (int i = 0; i < sizeof(g_titleid) && g_titleid[i]; i++)
+        hash = GUI_HASH(hash, g_titleid[i]);
+
     psvs_gui_set_text_scale(0.5f);
-    psvs_gui_printf(GUI_ANCHOR_LX(10, 0), GUI_ANCHOR_TY(8, 0), "%-9s", g_titleid);
+
+    // Draw TITLEID
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_TITLEID, hash))
+        psvs_gui_printf(GUI_ANCHOR_LX(10, 0), GUI_ANCHOR_TY(8, 0), "%-9s", g_titleid);
+
+    // Draw capture indicator, ERR stays until next start if file could not be written
+    bool capture = psvs_capture_is_running();
+    bool capture_failed = !capture && psvs_capture_has_failed();
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_CAPTURE, capture | (capture_failed << 1))) {
+        if (capture_failed)
+            psvs_gui_set_text_color(255, 150, 0, 255);
+        else
+            psvs_gui_set_text_color(255, 0, 0, 255);
+        psvs_gui_printf(GUI_ANCHOR_LX(10, 5), GUI_ANCHOR_TY(8, 0), capture ? "REC" : capture_failed ? "ERR" : "   ");
+        psvs_gui_set_text_color(255, 255, 255, 255);
+    }
+
+    // Draw thermal throttle indicator
+    psvs_thermal_level_t thermal = psvs_thermal_get_level();
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_THERMAL, thermal)) {
+        if (thermal == PSVS_THERMAL_LEVEL_HOT)
+            psvs_gui_set_text_color(255, 0, 0, 255);
+        else
+            psvs_gui_set_text_color(255, 150, 0, 255);
+        psvs_gui_printf(GUI_ANCHOR_LX(10, 5), GUI_ANCHOR_TY(20, 0),
+                        thermal == PSVS_THERMAL_LEVEL_HOT ? "hot " :
+                        thermal == PSVS_THERMAL_LEVEL_WARM ? "warm" : "    ");
+        psvs_gui_set_text_color(255, 255, 255, 255);
+    }
+
+    // Draw time spent copying/blending the buffer onto fb
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_CPY_TIME, g_gui_cpy_time))
+        psvs_gui_printf(GUI_ANCHOR_RX2(10, 10, 0.5f), GUI_ANCHOR_TY(20, 0), "cpy %4dus", g_gui_cpy_time);
+
+    // Draw time spent drawing FPS/battery directly onto fb
+    int dd_time = psvs_gui_get_dd_time();
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_DD_TIME, dd_time))
+        psvs_gui_printf(GUI_ANCHOR_LX(10, 0), GUI_ANCHOR_TY(20, 0), "dd %3dus", dd_time);
+
+    // Draw unique vs presented frame rate
+    int fps = psvs_perf_get_fps();
+    int present_fps = psvs_perf_get_present_fps();
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_FRAMES, GUI_HASH(GUI_HASH(GUI_HASH_INIT, fps), present_fps)))
+        psvs_gui_printf(GUI_ANCHOR_CX2(18, 0.5f), GUI_ANCHOR_TY(20, 0), "uniq %3d  pres %3d", fps, present_fps);
+
     psvs_gui_set_text_scale(1.0f);
 }
 
 void psvs_gui_draw_batt_section() {
     // PSTV
     if (g_is_dolce) {
-        psvs_gui_printf(GUI_ANCHOR_LX(10, 0), GUI_ANCHOR_TY(32, 0), "A/C");
+        if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_BATT, 0))
+            psvs_gui_printf(GUI_ANCHOR_LX(10, 0), GUI_ANCHOR_TY(32, 0), "A/C");
         return;
     }
 
     psvs_battery_t *batt = psvs_perf_get_batt();
-    if (!batt->_has_changed && !g_gui_lazydraw_batt)
+    uint32_t hash = GUI_HASH_INIT;
+    hash = GUI_HASH(hash, batt->temp);
+    hash = GUI_HASH(hash, batt->percent);
+    hash = GUI_HASH(hash, batt->lt_hours);
+    hash = GUI_HASH(hash, batt->lt_minutes);
+    hash = GUI_HASH(hash, batt->is_charging);
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_BATT, hash))
         return;
 
-    batt->_has_changed = false;
-    g_gui_lazydraw_batt = false;
-
     // Draw temp
     psvs_gui_set_text_color2(psvs_gui_scale_color(batt->temp, 30, 60));
     psvs_gui_printf(GUI_ANCHOR_RX(10, 11), GUI_ANCHOR_TY(32, 0), "%2d", batt->temp);
@@ -607,25 +1016,111 @@ void psvs_gui_draw_batt_section() {
 
 }
 
+// 4 chars wide: " 999", "9.9k", "999k", "999M"
+static void _psvs_gui_format_rate(char *buf, int size, int rate) {
+    if (rate < 1000)
+        snprintf(buf, size, "%4d", rate);
+    else if (rate < 10000)
+        snprintf(buf, size, "%d.%dk", rate / 1000, (rate % 1000) / 100);
+    else if (rate < 1000000)
+        snprintf(buf, size, "%3dk", rate / 1000);
+    else
+        snprintf(buf, size, "%3dM", rate / 1000000);
+}
+
+// Per-core context switches and wakeups, returns false if widget is up to date
+static bool _psvs_gui_format_cpu_rates(psvs_gui_widget_t widget, char sw[4][8], char wk[4][8]) {
+    int wakeups[4], switches[4];
+    uint32_t hash = GUI_HASH_INIT;
+    for (int i = 0; i < 4; i++) {
+        wakeups[i] = psvs_perf_get_wakeups(i);
+        switches[i] = psvs_perf_get_switches(i);
+        hash = GUI_HASH(GUI_HASH(hash, wakeups[i]), switches[i]);
+    }
+    if (!_psvs_gui_widget_update(widget, hash))
+        return false;
+
+    for (int i = 0; i < 4; i++) {
+        _psvs_gui_format_rate(sw[i], 8, switches[i]);
+        _psvs_gui_format_rate(wk[i], 8, wakeups[i]);
+    }
+    return true;
+}
+
+static void _psvs_gui_draw_cpu_rates() {
+    char sw[4][8], wk[4][8];
+    if (!_psvs_gui_format_cpu_rates(PSVS_GUI_WIDGET_CPU_RATES, sw, wk))
+        return;
+
+    // Context switches and wakeups per second, between "Peak:" and its value
+    psvs_gui_set_text_scale(0.5f);
+    psvs_gui_printf(GUI_ANCHOR_LX(16, 5), GUI_ANCHOR_TY(44, 2),
+                    "sw %s %s %s %s", sw[0], sw[1], sw[2], sw[3]);
+    psvs_gui_printf(GUI_ANCHOR_LX(16, 5), GUI_ANCHOR_TY(44, 2) + 12,
+                    "wk %s %s %s %s", wk[0], wk[1], wk[2], wk[3]);
+    psvs_gui_set_text_scale(1.0f);
+}
+
+void psvs_gui_draw_osd_rates() {
+    char sw[4][8], wk[4][8];
+    if (!_psvs_gui_format_cpu_rates(PSVS_GUI_WIDGET_OSD_CPU_RATES, sw, wk))
+        return;
+
+    // Context switches and wakeups per second, between stutter stats and graph
+    psvs_gui_set_text_scale(0.5f);
+    psvs_gui_printf(GUI_ANCHOR_LX(10, 0), GUI_ANCHOR_TY(8, 2) + 18,
+                    "sw %s %s %s %s  wk %s %s %s %s",
+                    sw[0], sw[1], sw[2], sw[3], wk[0], wk[1], wk[2], wk[3]);
+    psvs_gui_set_text_scale(1.0f);
+}
+
+static void _psvs_gui_draw_cpu_load_avg() {
+    int avg[2] = {0, 0};
+    for (int i = 0; i < 4; i++) {
+        avg[0] += psvs_perf_get_load_avg(i, PSVS_LOADAVG_5S);
+        avg[1] += psvs_perf_get_load_avg(i, PSVS_LOADAVG_15S);
+    }
+    avg[0] = (avg[0] + 2) / 4;
+    avg[1] = (avg[1] + 2) / 4;
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_CPU_LOAD_AVG, avg[0] | (avg[1] << 8)))
+        return;
+
+    // All-core 5s/15s load, between the rates and peak value
+    psvs_gui_set_text_scale(0.5f);
+    psvs_gui_printf(GUI_ANCHOR_RX(10, 4) - 6 * 6, GUI_ANCHOR_TY(44, 2),      " 5s%3d", avg[0]);
+    psvs_gui_printf(GUI_ANCHOR_RX(10, 4) - 6 * 6, GUI_ANCHOR_TY(44, 2) + 12, "15s%3d", avg[1]);
+    psvs_gui_set_text_scale(1.0f);
+}
+
 void psvs_gui_draw_cpu_section() {
     int load;
 
+    _psvs_gui_draw_cpu_rates();
+    _psvs_gui_draw_cpu_load_avg();
+
     // Draw AVG load
     for (int i = 0; i < 4; i++) {
         load = psvs_perf_get_load(i);
+        if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_CPU_LOAD + i, load))
+            continue;
         psvs_gui_set_text_color2(psvs_gui_scale_color(load, 0, 100));
         psvs_gui_printf(GUI_ANCHOR_RX(10, 19 - (i * 5)), GUI_ANCHOR_TY(44, 1), "%3d", load);
     }
 
     // Draw peak load
     load = psvs_perf_get_peak();
-    psvs_gui_set_text_color2(psvs_gui_scale_color(load, 0, 100));
-    psvs_gui_printf(GUI_ANCHOR_RX(10, 4), GUI_ANCHOR_TY(44, 2), "%3d", load);
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_CPU_PEAK, load)) {
+        psvs_gui_set_text_color2(psvs_gui_scale_color(load, 0, 100));
+        psvs_gui_printf(GUI_ANCHOR_RX(10, 4), GUI_ANCHOR_TY(44, 2), "%3d", load);
+    }
 
     psvs_gui_set_text_color(255, 255, 255, 255);
 }
 
 static void _psvs_gui_draw_memory_usage(int line, int total, int free, int limit) {
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_MEM + line - 3, GUI_HASH(GUI_HASH(GUI_HASH_INIT, total), free)))
+        return;
+
     if (total <= 0 && free <= 0) {
         psvs_gui_printf(GUI_ANCHOR_RX(10, 16), GUI_ANCHOR_TY(56, line), "          unused");
     }
@@ -656,21 +1151,147 @@ static void _psvs_gui_draw_memory_usage(int line, int total, int free, int limit
     }
 }
 
-void psvs_gui_draw_memory_section() {
-    psvs_memory_t *mem = psvs_perf_get_memusage();
-    if (!mem->_has_changed && !g_gui_lazydraw_memusage)
+// Peak main mem usage from the free low-water mark, between "MEM:" and the value
+static void _psvs_gui_draw_memory_peak(int total, int free_min) {
+    int peak = total > free_min && total <= 512 * 1024 * 1024 ? total - free_min : 0;
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_MEM_PEAK, peak))
+        return;
+
+    psvs_gui_set_text_scale(0.5f);
+    if (peak > 0)
+        psvs_gui_printf(GUI_ANCHOR_LX(13, 4), GUI_ANCHOR_TY(56, 3) + 6, "pk %3d%c",
+                        psvs_gui_value_from_size(peak), psvs_gui_units_from_size(peak)[0]);
+    else
+        psvs_gui_printf(GUI_ANCHOR_LX(13, 4), GUI_ANCHOR_TY(56, 3) + 6, "       ");
+    psvs_gui_set_text_scale(1.0f);
+}
+
+static void _psvs_gui_clear_area(int x, int y, int w, int h) {
+    int x0 = GUI_RESCALE_X(x);
+    int y0 = GUI_RESCALE_Y(y);
+    int bw = GUI_RESCALE_X(x + w) - x0;
+    int bh = GUI_RESCALE_Y(y + h) - y0;
+
+    _psvs_gui_mark_dirty(y0, bh);
+    for (int yy = 0; yy < bh; yy++)
+        memset(&g_gui_buffer[(y0 + yy) * GUI_WIDTH + x0], g_gui_color_bg, bw);
+}
+
+static void _psvs_gui_draw_session(const psvs_session_t *session, int y) {
+    const psvs_frametime_stats_t *ft = &session->frametime;
+
+    // Most used CPU freq
+    const psvs_session_residency_t *cpu = &session->residency[PSVS_OC_DEVICE_CPU][0];
+    for (int i = 1; i < PSVS_SESSION_FREQ_N; i++) {
+        if (session->residency[PSVS_OC_DEVICE_CPU][i].time > cpu->time)
+            cpu = &session->residency[PSVS_OC_DEVICE_CPU][i];
+    }
+    int cpu_pct = session->time ? ((uint64_t)cpu->time * 100) / session->time : 0;
+
+    uint32_t hash = GUI_HASH_INIT;
+    hash = GUI_HASH(hash, session->state);
+    hash = GUI_HASH(hash, session->time / 1000);
+    hash = GUI_HASH(hash, session->fps10);
+    hash = GUI_HASH(hash, ft->p50);
+    hash = GUI_HASH(hash, ft->p99);
+    hash = GUI_HASH(hash, ft->p99_9);
+    hash = GUI_HASH(hash, ft->low_1);
+    for (int i = 0; i < 4; i++) {
+        hash = GUI_HASH(hash, session->load_avg[i]);
+        hash = GUI_HASH(hash, session->load_peak[i]);
+    }
+    hash = GUI_HASH(hash, session->batt_end);
+    hash = GUI_HASH(hash, cpu->freq);
+    hash = GUI_HASH(hash, cpu_pct);
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_SESSION, hash))
         return;
 
-    mem->_has_changed = false;
-    g_gui_lazydraw_memusage = false;
+    uint32_t s = session->time / 1000;
+    psvs_gui_set_text_scale(0.5f);
+    if (session->state == PSVS_SESSION_STATE_RUNNING)
+        psvs_gui_set_text_color(255, 0, 0, 255);
+    else
+        psvs_gui_set_text_color(0, 200, 255, 255);
+    psvs_gui_printf(GUI_ANCHOR_LX(10, 0), y, "%s %3u:%02u",
+                    session->state == PSVS_SESSION_STATE_RUNNING ? "session" : "result ", s / 60, s % 60);
+    psvs_gui_set_text_color(255, 255, 255, 255);
+    psvs_gui_printf(GUI_ANCHOR_LX(10, 7), y, "  avg %3d.%d fps  1%% low %3d",
+                    session->fps10 / 10, session->fps10 % 10, ft->low_1);
+    psvs_gui_printf(GUI_ANCHOR_LX(10, 0), y + 12, "p50 %2u.%u  p99 %2u.%u  p99.9 %2u.%u ms",
+                    ft->p50 / 1000, (ft->p50 % 1000) / 100,
+                    ft->p99 / 1000, (ft->p99 % 1000) / 100,
+                    ft->p99_9 / 1000, (ft->p99_9 % 1000) / 100);
+    psvs_gui_printf(GUI_ANCHOR_LX(10, 0), y + 24, "load %3d %3d %3d %3d%%  peak %3d %3d %3d %3d%%",
+                    session->load_avg[0], session->load_avg[1], session->load_avg[2], session->load_avg[3],
+                    session->load_peak[0], session->load_peak[1], session->load_peak[2], session->load_peak[3]);
+    if (g_is_dolce)
+        psvs_gui_printf(GUI_ANCHOR_LX(10, 0), y + 36, "batt  A/C          CPU %3d MHz %3d%%",
+                        cpu->freq, cpu_pct);
+    else
+        psvs_gui_printf(GUI_ANCHOR_LX(10, 0), y + 36, "batt %3d%% -> %3d%%  CPU %3d MHz %3d%%",
+                        session->batt_start, session->batt_end, cpu->freq, cpu_pct);
+    psvs_gui_set_text_scale(1.0f);
+}
+
+void psvs_gui_draw_graph_section() {
+    // Session panel takes the place of the graph while there is one
+    const psvs_session_t *session = psvs_session_get();
+    bool show_session = session->state != PSVS_SESSION_STATE_IDLE;
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_GRAPH_SECTION, show_session)) {
+        _psvs_gui_clear_area(10, GUI_ANCHOR_TY(62, 6), GUI_WIDTH - 20, 46);
+        g_gui_widgets[PSVS_GUI_WIDGET_GRAPH].valid = false;
+        g_gui_widgets[PSVS_GUI_WIDGET_FRAMETIME_STATS].valid = false;
+        g_gui_widgets[PSVS_GUI_WIDGET_SESSION].valid = false;
+    }
+
+    if (show_session) {
+        _psvs_gui_draw_session(session, GUI_ANCHOR_TY(62, 6));
+        return;
+    }
+
+    psvs_frametime_stats_t stats;
+    psvs_perf_get_frametime_stats(&stats);
+
+    uint32_t hash = GUI_HASH_INIT;
+    hash = GUI_HASH(hash, stats.p50);
+    hash = GUI_HASH(hash, stats.p99);
+    hash = GUI_HASH(hash, stats.p99_9);
+    hash = GUI_HASH(hash, stats.low_1);
+    if (_psvs_gui_widget_update(PSVS_GUI_WIDGET_FRAMETIME_STATS, hash)) {
+        // Percentiles in ms with one decimal
+        psvs_gui_set_text_scale(0.5f);
+        psvs_gui_printf(GUI_ANCHOR_LX(10, 0), GUI_ANCHOR_TY(62, 6),
+                        "p50 %2d.%d  p99 %2d.%d  p99.9 %2d.%d ms  1%% low %3d",
+                        stats.p50 / 1000, (stats.p50 % 1000) / 100,
+                        stats.p99 / 1000, (stats.p99 % 1000) / 100,
+                        stats.p99_9 / 1000, (stats.p99_9 % 1000) / 100,
+                        stats.low_1);
+        psvs_gui_set_text_scale(1.0f);
+    }
+
+    _psvs_gui_draw_graph(PSVS_GUI_WIDGET_GRAPH, 10, GUI_ANCHOR_TY(62, 6) + 14, GUI_WIDTH - 20, 32);
+}
+
+void psvs_gui_draw_memory_section() {
+    psvs_memory_t *mem = psvs_perf_get_memusage();
 
     _psvs_gui_draw_memory_usage(3, mem->main_total, mem->main_free, 512 * 1024 * 1024);
+    _psvs_gui_draw_memory_peak(mem->main_total, mem->main_free_min);
     _psvs_gui_draw_memory_usage(4, mem->cdram_total, mem->cdram_free, 128 * 1024 * 1024);
     _psvs_gui_draw_memory_usage(5, mem->phycont_total, mem->phycont_free, 26 * 1024 * 1024);
 }
 
 static void _psvs_gui_draw_menu_item(int lines, int clock, psvs_gui_menu_control_t menuctrl) {
-    if (g_gui_menu_control == menuctrl) {
+    bool selected = g_gui_menu_control == menuctrl;
+    psvs_oc_mode_t mode = psvs_oc_get_mode(_psvs_gui_get_device_from_menuctrl(menuctrl));
+    bool manual = mode == PSVS_OC_MODE_MANUAL;
+    bool governor = mode == PSVS_OC_MODE_GOVERNOR;
+    int target_fps = governor ? psvs_oc_get_target_fps() : 0;
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_MENU + menuctrl,
+                clock | (selected << 16) | (mode << 17) | (target_fps << 20)))
+        return;
+
+    if (selected) {
         psvs_gui_set_text_color(0, 200, 255, 255);
         psvs_gui_printf(GUI_ANCHOR_CX(19),                        GUI_ANCHOR_BY(10, lines), ">");
         psvs_gui_printf(GUI_ANCHOR_CX(19) + GUI_ANCHOR_LX(0, 18), GUI_ANCHOR_BY(10, lines), "<");
@@ -680,26 +1301,83 @@ static void _psvs_gui_draw_menu_item(int lines, int clock, psvs_gui_menu_control
         psvs_gui_printf(GUI_ANCHOR_CX(19) + GUI_ANCHOR_LX(0, 18), GUI_ANCHOR_BY(10, lines), " ");
     }
 
-    // Highlight freq if in manual mode
-    if (psvs_oc_get_mode(_psvs_gui_get_device_from_menuctrl(menuctrl)) == PSVS_OC_MODE_MANUAL) {
+    // Highlight freq if in manual or governor mode
+    if (manual) {
         psvs_gui_set_text_color(0, 200, 255, 255);
+    } else if (governor) {
+        psvs_gui_set_text_color(0, 255, 100, 255);
     }
     psvs_gui_printf(GUI_ANCHOR_CX(15) + GUI_ANCHOR_LX(0, 6),  GUI_ANCHOR_BY(10, lines), "%3d MHz", clock);
+
+    // Governor target FPS, right of the item
+    psvs_gui_set_text_scale(0.5f);
+    if (governor)
+        psvs_gui_printf(GUI_ANCHOR_CX(19) + GUI_ANCHOR_LX(0, 19), GUI_ANCHOR_BY(4, lines), "%2dfps", target_fps);
+    else
+        psvs_gui_printf(GUI_ANCHOR_CX(19) + GUI_ANCHOR_LX(0, 19), GUI_ANCHOR_BY(4, lines), "     ");
+    psvs_gui_set_text_scale(1.0f);
+    psvs_gui_set_text_color(255, 255, 255, 255);
+}
+
+static void _psvs_gui_draw_autotune(int lines) {
+    psvs_autotune_state_t state = psvs_autotune_get_state();
+    bool selected = g_gui_menu_control == PSVS_GUI_MENUCTRL_AUTOTUNE;
+    int done, total;
+    psvs_autotune_get_progress(&done, &total);
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_MENU + PSVS_GUI_MENUCTRL_AUTOTUNE,
+                state | (selected << 2) | (done << 3)))
+        return;
+
+    switch (state) {
+        case PSVS_AUTOTUNE_STATE_RUNNING:
+            psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, lines), "  tuning %2d/%-2d   ", done + 1, total);
+            break;
+        case PSVS_AUTOTUNE_STATE_DONE:
+            psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, lines), "   tuned, saved   ");
+            break;
+        case PSVS_AUTOTUNE_STATE_FAILED:
+            psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, lines), "   tune failed    ");
+            break;
+        default:
+            psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, lines), "    auto-tune     ");
+            break;
+    }
+
+    psvs_gui_set_text_color(0, 200, 255, 255);
+    psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, lines), selected ? ">" : " ");
+    psvs_gui_printf(GUI_ANCHOR_CX(18) + GUI_ANCHOR_LX(0, 17), GUI_ANCHOR_BY(10, lines), selected ? "<" : " ");
     psvs_gui_set_text_color(255, 255, 255, 255);
 }
 
 void psvs_gui_draw_menu() {
-    _psvs_gui_draw_menu_item(6, psvs_oc_get_freq(PSVS_OC_DEVICE_CPU), PSVS_GUI_MENUCTRL_CPU);
-    _psvs_gui_draw_menu_item(5, psvs_oc_get_freq(PSVS_OC_DEVICE_GPU_ES4), PSVS_GUI_MENUCTRL_GPU_ES4);
-    _psvs_gui_draw_menu_item(4, psvs_oc_get_freq(PSVS_OC_DEVICE_BUS), PSVS_GUI_MENUCTRL_BUS);
-    _psvs_gui_draw_menu_item(3, psvs_oc_get_freq(PSVS_OC_DEVICE_GPU_XBAR), PSVS_GUI_MENUCTRL_GPU_XBAR);
-    _psvs_gui_draw_menu_item(2, psvs_oc_get_freq(PSVS_OC_DEVICE_VENEZIA), PSVS_GUI_MENUCTRL_VENEZIA);
+    _psvs_gui_draw_menu_item(7, psvs_oc_get_freq(PSVS_OC_DEVICE_CPU), PSVS_GUI_MENUCTRL_CPU);
+    _psvs_gui_draw_menu_item(6, psvs_oc_get_freq(PSVS_OC_DEVICE_GPU_ES4), PSVS_GUI_MENUCTRL_GPU_ES4);
+    _psvs_gui_draw_menu_item(5, psvs_oc_get_freq(PSVS_OC_DEVICE_BUS), PSVS_GUI_MENUCTRL_BUS);
+    _psvs_gui_draw_menu_item(4, psvs_oc_get_freq(PSVS_OC_DEVICE_GPU_XBAR), PSVS_GUI_MENUCTRL_GPU_XBAR);
+    _psvs_gui_draw_menu_item(3, psvs_oc_get_freq(PSVS_OC_DEVICE_VENEZIA), PSVS_GUI_MENUCTRL_VENEZIA);
+    _psvs_gui_draw_autotune(2);
 
     // Draw profile label separately
     bool show_global = g_gui_input_buttons & GUI_GLOBAL_PROFILE_BUTTON_MOD;
     bool save = (!show_global && psvs_oc_has_changed()) || !psvs_profile_exists(show_global);
+    bool selected = g_gui_menu_control == PSVS_GUI_MENUCTRL_PROFILE;
+    psvs_profile_write_t write_state = psvs_profile_get_write_state();
+    if (!_psvs_gui_widget_update(PSVS_GUI_WIDGET_MENU + PSVS_GUI_MENUCTRL_PROFILE,
+                show_global | (save << 1) | (selected << 2) | (write_state << 3)))
+        return;
 
-    if (save) {
+    // Db file is written in background, show how that went for a moment
+    if (write_state == PSVS_PROFILE_WRITE_PENDING) {
+        psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, 1), "    pending...    ");
+    } else if (write_state == PSVS_PROFILE_WRITE_SAVED) {
+        psvs_gui_set_text_color(0, 255, 0, 255);
+        psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, 1), "      saved       ");
+        psvs_gui_set_text_color(255, 255, 255, 255);
+    } else if (write_state == PSVS_PROFILE_WRITE_FAILED) {
+        psvs_gui_set_text_color(255, 0, 0, 255);
+        psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, 1), "   write failed   ");
+        psvs_gui_set_text_color(255, 255, 255, 255);
+    } else if (save) {
         if (show_global)
             psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, 1), "   save default   ");
         else
@@ -710,7 +1388,7 @@ void psvs_gui_draw_menu() {
         else
             psvs_gui_printf(GUI_ANCHOR_CX(18), GUI_ANCHOR_BY(10, 1), "  delete profile  ");
     }
-    if (g_gui_menu_control == PSVS_GUI_MENUCTRL_PROFILE) {
+    if (selected) {
         psvs_gui_set_text_color(0, 200, 255, 255);
         psvs_gui_printf(GUI_ANCHOR_CX(save ? 16 : 18), GUI_ANCHOR_BY(10, 1), ">");
         psvs_gui_printf(GUI_ANCHOR_CX(save ? 16 : 18) + GUI_ANCHOR_LX(0, save ? 15 : 17),
@@ -723,14 +1401,55 @@ void psvs_gui_draw_menu() {
     }
 }
 
+void psvs_gui_flip() {
+    if (!g_gui_dirty)
+        return; // nothing new to show
+
+    int back = !g_gui_buffer_front;
+
+    // Publish back buffer, hook picks it up on its next copy
+    __atomic_store_n(&g_gui_buffer_front, back, __ATOMIC_SEQ_CST);
+
+    // Wait for the hook to finish copying from the old front buffer
+    while (__atomic_load_n(&g_gui_buffer_reading, __ATOMIC_SEQ_CST) == !back)
+        ksceKernelDelayThread(1000);
+
+    // Bring old front buffer up to date and draw into it from now on
+    for (int y = 0; y < GUI_HEIGHT; y++) {
+        if (!g_gui_dirty_rows[y])
+            continue;
+
+        int y0 = y;
+        while (y < GUI_HEIGHT && g_gui_dirty_rows[y])
+            y++;
+
+        memcpy(&g_gui_buffers[!back][y0 * GUI_WIDTH],
+               &g_gui_buffers[back][y0 * GUI_WIDTH],
+               (y - y0) * GUI_WIDTH);
+    }
+    g_gui_buffer = g_gui_buffers[!back];
+
+    memset(g_gui_dirty_rows, false, sizeof(g_gui_dirty_rows));
+    g_gui_dirty = false;
+}
+
 int psvs_gui_init() {
-    int size = (GUI_WIDTH * GUI_HEIGHT * sizeof(rgba_t) + 0xfff) & ~0xfff;
+    int buffer_size = GUI_WIDTH * GUI_HEIGHT;
+    int size = (buffer_size * 2 + 0xfff) & ~0xfff;
     g_gui_buffer_uid = ksceKernelAllocMemBlock("psvs_gui", SCE_KERNEL_MEMBLOCK_TYPE_KERNEL_RW, size, NULL);
     if (g_gui_buffer_uid < 0) {
         return g_gui_buffer_uid;
     }
 
-    ksceKernelGetMemBlockBase(g_gui_buffer_uid, (void **)&g_gui_buffer);
+    ksceKernelGetMemBlockBase(g_gui_buffer_uid, (void **)&g_gui_buffers[0]);
+    g_gui_buffers[1] = g_gui_buffers[0] + buffer_size;
+    g_gui_color_bg = _psvs_gui_palette_index(BLACK);
+    g_gui_color_text = _psvs_gui_palette_index(WHITE);
+    memset(g_gui_buffers[0], g_gui_color_bg, buffer_size * 2);
+    g_gui_buffer = g_gui_buffers[!g_gui_buffer_front];
+
+    // Default font, until the first framebuffer is seen
+    _psvs_gui_build_atlas();
 
     return 0;
 }
@@ -741,39 +1460,57 @@ void psvs_gui_deinit() {
 }
 
 void psvs_gui_cpy() {
-    int height = (g_gui_mode == PSVS_GUI_MODE_OSD) ? GUI_OSD_HEIGHT : GUI_HEIGHT;
-
-    int w = GUI_RESCALE_X(GUI_WIDTH);
-    int h = GUI_RESCALE_Y(height);
-    int x = (g_gui_mode == PSVS_GUI_MODE_OSD) ? 10 : (g_gui_fb.width / 2) - (w / 2);
-    int y = (g_gui_mode == PSVS_GUI_MODE_OSD) ? 10 : (g_gui_fb.height / 2) - (h / 2);
+    bool osd = g_gui_mode == PSVS_GUI_MODE_OSD;
+    const psvs_gui_layout_t *layout = g_gui_layout;
+
+    int w = osd ? layout->osd_w : layout->full_w;
+    int h = osd ? layout->osd_h : layout->full_h;
+    int x = osd ? 10 : g_gui_full_x;
+    int y = osd ? 10 : g_gui_full_y;
+    const unsigned char *xd = osd ? layout->osd_xd : layout->full_xd;
+
+    SceUInt32 tick_start = ksceKernelGetProcessTimeLowCore();
+
+    // Claim current front buffer, retry if it got flipped meanwhile
+    int front;
+    do {
+        front = __atomic_load_n(&g_gui_buffer_front, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&g_gui_buffer_reading, front, __ATOMIC_SEQ_CST);
+    } while (__atomic_load_n(&g_gui_buffer_front, __ATOMIC_SEQ_CST) != front);
+
+    const uint8_t *buffer = g_gui_buffers[front];
+
+    // Pack palette entries added since last copy
+    int palette_n = __atomic_load_n(&g_gui_palette_n, __ATOMIC_ACQUIRE);
+    if (g_gui_palette_packed_blit != g_gui_blit) {
+        g_gui_palette_packed_blit = g_gui_blit;
+        g_gui_palette_packed_n = 0;
+    }
+    for (; g_gui_palette_packed_n < palette_n; g_gui_palette_packed_n++) {
+        g_gui_palette_packed[g_gui_palette_packed_n] = g_gui_blit->pack(g_gui_palette[g_gui_palette_packed_n]);
+    }
 
     uint32_t dacr;
     DACR_UNRESTRICT(dacr);
 
-    for (int line = 0; line < h; line++) {
-        int xd = 0;
-        int xd_line = line;
-        if (g_gui_fb.height < 544.0f)
-            xd_line = xd_line * (544.0f / g_gui_fb.height);
-
-        // Top corners
-        if (xd_line < GUI_CORNERS_XD_RADIUS) {
-            xd = GUI_RESCALE_X(GUI_CORNERS_XD[xd_line]);
-        }
-        // Bottom corners
-        else if (xd_line >= height - GUI_CORNERS_XD_RADIUS) {
-            xd = GUI_RESCALE_X(GUI_CORNERS_XD[height - xd_line - 1]);
-        }
+    uint32_t *dest = (uint32_t *)g_gui_fb.base + y * g_gui_fb.pitch + x;
 
-        int off = ((line + y) * g_gui_fb.pitch + x + xd);
+    for (int line = 0; line < h; line++, dest += g_gui_fb.pitch) {
+        // Clip rounded corners
+        const uint8_t *src = &buffer[line * GUI_WIDTH + xd[line]];
+        int n = w - xd[line] * 2;
 
-        void *src = &((rgba_t *)g_gui_buffer)[line * GUI_WIDTH + xd];
-        void *dest = &((rgba_t *)g_gui_fb.base)[off];
-        int size = sizeof(rgba_t) * (w - xd*2);
-
-        memcpy(dest, src, size);
+        if (g_gui_translucent) {
+            psvs_blit_expand_row((uint32_t *)g_gui_cpy_row, src, (const uint32_t *)g_gui_palette, n);
+            g_gui_blit->blend_row(dest + xd[line], g_gui_cpy_row, n);
+        } else {
+            psvs_blit_expand_row(dest + xd[line], src, g_gui_palette_packed, n);
+        }
     }
 
     DACR_RESET(dacr);
+
+    __atomic_store_n(&g_gui_buffer_reading, -1, __ATOMIC_SEQ_CST);
+
+    g_gui_cpy_time = ksceKernelGetProcessTimeLowCore() - tick_start;
 }
@@ -3,9 +3,12 @@
 
 // scaling done internally
 #define GUI_WIDTH  308
-#define GUI_HEIGHT 368
+#define GUI_HEIGHT 440
 
-#define GUI_OSD_HEIGHT 64
+#define GUI_OSD_HEIGHT 116
+
+// bg alpha used when blending the buffer over the game
+#define GUI_TRANSLUCENT_ALPHA 160
 
 #define GUI_BATT_SIZE_W 32
 #define GUI_BATT_SIZE_H 16
@@ -25,8 +28,9 @@
 #define GUI_ANCHOR_CX2(len, scale) (GUI_WIDTH / 2 - ((len) * GUI_FONT_W * (scale)) / 2)
 #define GUI_ANCHOR_CY(lines) (GUI_HEIGHT / 2 - ((lines) * GUI_FONT_H) / 2)
 
-#define GUI_RESCALE_X(x) (int)((x) * (g_gui_fb_w_ratio > 1.0f ? 1.0f : g_gui_fb_w_ratio))
-#define GUI_RESCALE_Y(y) (int)((y) * (g_gui_fb_h_ratio > 1.0f ? 1.0f : g_gui_fb_h_ratio))
+// Looked up in gui_layout.h tables, (x) in [0, GUI_WIDTH], (y) in [0, GUI_HEIGHT]
+#define GUI_RESCALE_X(x) ((int)g_gui_layout->rescale_x[(x)])
+#define GUI_RESCALE_Y(y) ((int)g_gui_layout->rescale_y[(y)])
 
 #define GUI_GLOBAL_PROFILE_BUTTON_MOD SCE_CTRL_LTRIGGER
 
@@ -56,15 +60,18 @@ typedef enum {
     PSVS_GUI_MENUCTRL_BUS,
     PSVS_GUI_MENUCTRL_GPU_XBAR,
     PSVS_GUI_MENUCTRL_VENEZIA,
+    PSVS_GUI_MENUCTRL_AUTOTUNE,
     PSVS_GUI_MENUCTRL_PROFILE,
     PSVS_GUI_MENUCTRL_MAX
 } psvs_gui_menu_control_t;
 
 psvs_gui_mode_t psvs_gui_get_mode();
+int psvs_gui_get_cpy_time();
+int psvs_gui_get_dd_time();
 
 void psvs_gui_input_check(uint32_t buttons);
 
-void psvs_gui_set_framebuf(const SceDisplayFrameBuf *pParam);
+bool psvs_gui_set_framebuf(const SceDisplayFrameBuf *pParam);
 bool psvs_gui_fb_res_changed();
 bool psvs_gui_mode_changed();
 
@@ -88,16 +95,21 @@ void psvs_gui_draw_osd_template();
 void psvs_gui_draw_osd_cpu();
 void psvs_gui_draw_osd_fps();
 void psvs_gui_draw_osd_batt();
+void psvs_gui_draw_osd_graph();
+void psvs_gui_draw_osd_stutter();
+void psvs_gui_draw_osd_rates();
 
 void psvs_gui_draw_template();
 void psvs_gui_draw_header();
 void psvs_gui_draw_batt_section();
 void psvs_gui_draw_cpu_section();
 void psvs_gui_draw_memory_section();
+void psvs_gui_draw_graph_section();
 void psvs_gui_draw_menu();
 
 int psvs_gui_init();
 void psvs_gui_deinit();
 void psvs_gui_cpy();
+void psvs_gui_flip();
 
 #endif
@@ -0,0 +1,912 @@
+/*
+ * Generated by tools/gen_gui_font.py, do not edit.
+ *
+ * Copyright (c) 2018 Dimitar Toshkov Zhekov,
+ * with Reserved Font Name "Terminus Font".
+ *
+ * This Font Software is licensed under the SIL Open Font License, Version 1.1.
+ * This license is available with a FAQ at http://scripts.sil.org/OFL
+ *
+ * Version 4.47
+ */
+
+typedef struct {
+    unsigned char width;
+    unsigned char height;
+    const unsigned short *rows; // [GUI_FONT_GLYPHS][height], bit n set => px at column n
+} psvs_gui_font_t;
+
+#define GUI_FONT_GLYPHS 95
+
+// char -> glyph index
+static const unsigned char GUI_FONT_REMAP[256] = {
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+};
+
+static const unsigned short FONT_TER_U14B_ROWS[GUI_FONT_GLYPHS * 14] = {
+    // ' '
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000,
+    // '!'
+    0x0000, 0x0000, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0000, 0x0018, 0x0018,
+    0x0000, 0x0000,
+    // '"'
+    0x0000, 0x0066, 0x0066, 0x0066, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000,
+    // '#'
+    0x0000, 0x0000, 0x0036, 0x0036, 0x0036, 0x007f, 0x0036, 0x0036, 0x007f, 0x0036, 0x0036, 0x0036,
+    0x0000, 0x0000,
+    // '$'
+    0x0000, 0x0008, 0x0008, 0x003e, 0x006b, 0x000b, 0x000b, 0x003e, 0x0068, 0x0068, 0x006b, 0x003e,
+    0x0008, 0x0008,
+    // '%'
+    0x0000, 0x0000, 0x0066, 0x006b, 0x0036, 0x0030, 0x0018, 0x0018, 0x000c, 0x006c, 0x00d6, 0x0066,
+    0x0000, 0x0000,
+    // '&'
+    0x0000, 0x0000, 0x001c, 0x0036, 0x0036, 0x001c, 0x006e, 0x003b, 0x0033, 0x0033, 0x003b, 0x006e,
+    0x0000, 0x0000,
+    // "'"
+    0x0000, 0x0018, 0x0018, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000,
+    // '('
+    0x0000, 0x0000, 0x0030, 0x0018, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0018, 0x0030,
+    0x0000, 0x0000,
+    // ')'
+    0x0000, 0x0000, 0x000c, 0x0018, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0018, 0x000c,
+    0x0000, 0x0000,
+    // '*'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0036, 0x001c, 0x007f, 0x001c, 0x0036, 0x0000, 0x0000,
+    0x0000, 0x0000,
+    // '+'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0018, 0x007e, 0x0018, 0x0018, 0x0000, 0x0000,
+    0x0000, 0x0000,
+    // ','
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0018,
+    0x000c, 0x0000,
+    // '-'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000,
+    // '.'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0018,
+    0x0000, 0x0000,
+    // '/'
+    0x0000, 0x0000, 0x0060, 0x0060, 0x0030, 0x0030, 0x0018, 0x0018, 0x000c, 0x000c, 0x0006, 0x0006,
+    0x0000, 0x0000,
+    // '0'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0073, 0x007b, 0x006f, 0x0067, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // '1'
+    0x0000, 0x0000, 0x0018, 0x001c, 0x001e, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x007e,
+    0x0000, 0x0000,
+    // '2'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x0003, 0x007f,
+    0x0000, 0x0000,
+    // '3'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0060, 0x003c, 0x0060, 0x0060, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // '4'
+    0x0000, 0x0000, 0x0060, 0x0070, 0x0078, 0x006c, 0x0066, 0x0063, 0x007f, 0x0060, 0x0060, 0x0060,
+    0x0000, 0x0000,
+    // '5'
+    0x0000, 0x0000, 0x007f, 0x0003, 0x0003, 0x0003, 0x003f, 0x0060, 0x0060, 0x0060, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // '6'
+    0x0000, 0x0000, 0x003c, 0x0006, 0x0003, 0x0003, 0x003f, 0x0063, 0x0063, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // '7'
+    0x0000, 0x0000, 0x007f, 0x0060, 0x0060, 0x0030, 0x0030, 0x0018, 0x0018, 0x000c, 0x000c, 0x000c,
+    0x0000, 0x0000,
+    // '8'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0063, 0x003e, 0x0063, 0x0063, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // '9'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0063, 0x0063, 0x007e, 0x0060, 0x0060, 0x0030, 0x001e,
+    0x0000, 0x0000,
+    // ':'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0018, 0x0000, 0x0000, 0x0000, 0x0018, 0x0018,
+    0x0000, 0x0000,
+    // ';'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0018, 0x0000, 0x0000, 0x0000, 0x0018, 0x0018,
+    0x000c, 0x0000,
+    // '<'
+    0x0000, 0x0000, 0x0000, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x000c, 0x0018, 0x0030, 0x0060,
+    0x0000, 0x0000,
+    // '='
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x0000, 0x007f, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000,
+    // '>'
+    0x0000, 0x0000, 0x0000, 0x0006, 0x000c, 0x0018, 0x0030, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006,
+    0x0000, 0x0000,
+    // '?'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0063, 0x0030, 0x0018, 0x0018, 0x0000, 0x0018, 0x0018,
+    0x0000, 0x0000,
+    // '@'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0073, 0x006b, 0x006b, 0x006b, 0x006b, 0x0073, 0x0003, 0x007e,
+    0x0000, 0x0000,
+    // 'A'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0063, 0x0063, 0x007f, 0x0063, 0x0063, 0x0063, 0x0063,
+    0x0000, 0x0000,
+    // 'B'
+    0x0000, 0x0000, 0x003f, 0x0063, 0x0063, 0x0063, 0x003f, 0x0063, 0x0063, 0x0063, 0x0063, 0x003f,
+    0x0000, 0x0000,
+    // 'C'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0003, 0x0003, 0x0003, 0x0003, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // 'D'
+    0x0000, 0x0000, 0x001f, 0x0033, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0033, 0x001f,
+    0x0000, 0x0000,
+    // 'E'
+    0x0000, 0x0000, 0x007f, 0x0003, 0x0003, 0x0003, 0x001f, 0x0003, 0x0003, 0x0003, 0x0003, 0x007f,
+    0x0000, 0x0000,
+    // 'F'
+    0x0000, 0x0000, 0x007f, 0x0003, 0x0003, 0x0003, 0x001f, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+    0x0000, 0x0000,
+    // 'G'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0003, 0x0003, 0x007b, 0x0063, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // 'H'
+    0x0000, 0x0000, 0x0063, 0x0063, 0x0063, 0x0063, 0x007f, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063,
+    0x0000, 0x0000,
+    // 'I'
+    0x0000, 0x0000, 0x003c, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x003c,
+    0x0000, 0x0000,
+    // 'J'
+    0x0000, 0x0000, 0x0078, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0033, 0x001e,
+    0x0000, 0x0000,
+    // 'K'
+    0x0000, 0x0000, 0x0063, 0x0063, 0x0033, 0x001b, 0x000f, 0x000f, 0x001b, 0x0033, 0x0063, 0x0063,
+    0x0000, 0x0000,
+    // 'L'
+    0x0000, 0x0000, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x007f,
+    0x0000, 0x0000,
+    // 'M'
+    0x0000, 0x0000, 0x0041, 0x0063, 0x0077, 0x007f, 0x006b, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063,
+    0x0000, 0x0000,
+    // 'N'
+    0x0000, 0x0000, 0x0063, 0x0063, 0x0063, 0x0067, 0x006f, 0x007b, 0x0073, 0x0063, 0x0063, 0x0063,
+    0x0000, 0x0000,
+    // 'O'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // 'P'
+    0x0000, 0x0000, 0x003f, 0x0063, 0x0063, 0x0063, 0x0063, 0x003f, 0x0003, 0x0003, 0x0003, 0x0003,
+    0x0000, 0x0000,
+    // 'Q'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x007b, 0x003e,
+    0x0060, 0x0000,
+    // 'R'
+    0x0000, 0x0000, 0x003f, 0x0063, 0x0063, 0x0063, 0x0063, 0x003f, 0x000f, 0x001b, 0x0033, 0x0063,
+    0x0000, 0x0000,
+    // 'S'
+    0x0000, 0x0000, 0x003e, 0x0063, 0x0003, 0x0003, 0x003e, 0x0060, 0x0060, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // 'T'
+    0x0000, 0x0000, 0x00ff, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0000, 0x0000,
+    // 'U'
+    0x0000, 0x0000, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // 'V'
+    0x0000, 0x0000, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0036, 0x0036, 0x0036, 0x001c, 0x001c,
+    0x0000, 0x0000,
+    // 'W'
+    0x0000, 0x0000, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x006b, 0x007f, 0x0077, 0x0063, 0x0041,
+    0x0000, 0x0000,
+    // 'X'
+    0x0000, 0x0000, 0x0063, 0x0063, 0x0036, 0x0036, 0x001c, 0x001c, 0x0036, 0x0036, 0x0063, 0x0063,
+    0x0000, 0x0000,
+    // 'Y'
+    0x0000, 0x0000, 0x00c3, 0x00c3, 0x0066, 0x0066, 0x003c, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0000, 0x0000,
+    // 'Z'
+    0x0000, 0x0000, 0x007f, 0x0060, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x0003, 0x0003, 0x007f,
+    0x0000, 0x0000,
+    // '['
+    0x0000, 0x0000, 0x003c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x003c,
+    0x0000, 0x0000,
+    // '\\'
+    0x0000, 0x0000, 0x0006, 0x0006, 0x000c, 0x000c, 0x0018, 0x0018, 0x0030, 0x0030, 0x0060, 0x0060,
+    0x0000, 0x0000,
+    // ']'
+    0x0000, 0x0000, 0x003c, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x003c,
+    0x0000, 0x0000,
+    // '^'
+    0x0000, 0x0018, 0x003c, 0x0066, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000,
+    // '_'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x007f, 0x0000,
+    // '`'
+    0x000c, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000,
+    // 'a'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003e, 0x0060, 0x007e, 0x0063, 0x0063, 0x0063, 0x007e,
+    0x0000, 0x0000,
+    // 'b'
+    0x0000, 0x0000, 0x0003, 0x0003, 0x0003, 0x003f, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x003f,
+    0x0000, 0x0000,
+    // 'c'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003e, 0x0063, 0x0003, 0x0003, 0x0003, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // 'd'
+    0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x007e, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x007e,
+    0x0000, 0x0000,
+    // 'e'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x007f, 0x0003, 0x0003, 0x003e,
+    0x0000, 0x0000,
+    // 'f'
+    0x0000, 0x0000, 0x0078, 0x000c, 0x000c, 0x003f, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+    0x0000, 0x0000,
+    // 'g'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x007e,
+    0x0060, 0x003e,
+    // 'h'
+    0x0000, 0x0000, 0x0003, 0x0003, 0x0003, 0x003f, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063,
+    0x0000, 0x0000,
+    // 'i'
+    0x0000, 0x0000, 0x0018, 0x0018, 0x0000, 0x001c, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x003c,
+    0x0000, 0x0000,
+    // 'j'
+    0x0000, 0x0000, 0x0060, 0x0060, 0x0000, 0x0070, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0066,
+    0x0066, 0x003c,
+    // 'k'
+    0x0000, 0x0000, 0x0003, 0x0003, 0x0003, 0x0063, 0x0033, 0x001b, 0x000f, 0x001b, 0x0033, 0x0063,
+    0x0000, 0x0000,
+    // 'l'
+    0x0000, 0x0000, 0x001c, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x003c,
+    0x0000, 0x0000,
+    // 'm'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003f, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b,
+    0x0000, 0x0000,
+    // 'n'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003f, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063,
+    0x0000, 0x0000,
+    // 'o'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003e, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x003e,
+    0x0000, 0x0000,
+    // 'p'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003f, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x003f,
+    0x0003, 0x0003,
+    // 'q'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x007e,
+    0x0060, 0x0060,
+    // 'r'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007b, 0x000f, 0x0007, 0x0003, 0x0003, 0x0003, 0x0003,
+    0x0000, 0x0000,
+    // 's'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x0003, 0x0003, 0x003e, 0x0060, 0x0060, 0x003f,
+    0x0000, 0x0000,
+    // 't'
+    0x0000, 0x0000, 0x000c, 0x000c, 0x000c, 0x003f, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0078,
+    0x0000, 0x0000,
+    // 'u'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x007e,
+    0x0000, 0x0000,
+    // 'v'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0063, 0x0063, 0x0063, 0x0036, 0x0036, 0x001c, 0x001c,
+    0x0000, 0x0000,
+    // 'w'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0063, 0x0063, 0x006b, 0x006b, 0x006b, 0x006b, 0x003e,
+    0x0000, 0x0000,
+    // 'x'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0063, 0x0063, 0x0036, 0x001c, 0x0036, 0x0063, 0x0063,
+    0x0000, 0x0000,
+    // 'y'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x007e,
+    0x0060, 0x003e,
+    // 'z'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007f, 0x0030, 0x0018, 0x000c, 0x0006, 0x0003, 0x007f,
+    0x0000, 0x0000,
+    // '{'
+    0x0000, 0x0000, 0x0038, 0x000c, 0x000c, 0x000c, 0x0006, 0x000c, 0x000c, 0x000c, 0x000c, 0x0038,
+    0x0000, 0x0000,
+    // '|'
+    0x0000, 0x0000, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0000, 0x0000,
+    // '}'
+    0x0000, 0x0000, 0x000e, 0x0018, 0x0018, 0x0018, 0x0030, 0x0018, 0x0018, 0x0018, 0x0018, 0x000e,
+    0x0000, 0x0000,
+    // '~'
+    0x0000, 0x00ce, 0x00db, 0x0073, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000,
+};
+static const psvs_gui_font_t FONT_TER_U14B = {
+    .width = 8, .height = 14, .rows = FONT_TER_U14B_ROWS
+};
+
+static const unsigned short FONT_TER_U18B_ROWS[GUI_FONT_GLYPHS * 18] = {
+    // ' '
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '!'
+    0x0000, 0x0000, 0x0000, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0000,
+    0x0000, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // '"'
+    0x0000, 0x00cc, 0x00cc, 0x00cc, 0x00cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '#'
+    0x0000, 0x0000, 0x0000, 0x00cc, 0x00cc, 0x00cc, 0x01fe, 0x00cc, 0x00cc, 0x00cc, 0x00cc, 0x01fe,
+    0x00cc, 0x00cc, 0x00cc, 0x0000, 0x0000, 0x0000,
+    // '$'
+    0x0000, 0x0000, 0x0030, 0x0030, 0x00fc, 0x01b6, 0x0036, 0x0036, 0x0036, 0x00fc, 0x01b0, 0x01b0,
+    0x01b0, 0x01b6, 0x00fc, 0x0030, 0x0030, 0x0000,
+    // '%'
+    0x0000, 0x0000, 0x0000, 0x00ce, 0x00ca, 0x006e, 0x0060, 0x0030, 0x0030, 0x0018, 0x0018, 0x000c,
+    0x00ec, 0x00a6, 0x00e6, 0x0000, 0x0000, 0x0000,
+    // '&'
+    0x0000, 0x0000, 0x0000, 0x003c, 0x0066, 0x0066, 0x0066, 0x003c, 0x019c, 0x01b6, 0x00e3, 0x00c3,
+    0x00c3, 0x01e6, 0x01bc, 0x0000, 0x0000, 0x0000,
+    // "'"
+    0x0000, 0x0030, 0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '('
+    0x0000, 0x0000, 0x0000, 0x0060, 0x0030, 0x0030, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0030, 0x0030, 0x0060, 0x0000, 0x0000, 0x0000,
+    // ')'
+    0x0000, 0x0000, 0x0000, 0x0018, 0x0030, 0x0030, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0030, 0x0030, 0x0018, 0x0000, 0x0000, 0x0000,
+    // '*'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c6, 0x006c, 0x0038, 0x01ff, 0x0038, 0x006c, 0x00c6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '+'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0030, 0x0030, 0x0030, 0x01fe, 0x0030, 0x0030, 0x0030,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ','
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0030, 0x0030, 0x0030, 0x0018, 0x0000, 0x0000,
+    // '-'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '.'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // '/'
+    0x0000, 0x0000, 0x0000, 0x00c0, 0x00c0, 0x0060, 0x0060, 0x0030, 0x0030, 0x0018, 0x0018, 0x000c,
+    0x000c, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000,
+    // '0'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x01c6, 0x01e6, 0x01b6, 0x019e, 0x018e, 0x0186,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // '1'
+    0x0000, 0x0000, 0x0000, 0x0030, 0x0038, 0x003c, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // '2'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0186, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0018,
+    0x000c, 0x0006, 0x01fe, 0x0000, 0x0000, 0x0000,
+    // '3'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0180, 0x0180, 0x00f8, 0x0180, 0x0180, 0x0180,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // '4'
+    0x0000, 0x0000, 0x0000, 0x0180, 0x01c0, 0x01e0, 0x01b0, 0x0198, 0x018c, 0x0186, 0x0186, 0x01fe,
+    0x0180, 0x0180, 0x0180, 0x0000, 0x0000, 0x0000,
+    // '5'
+    0x0000, 0x0000, 0x0000, 0x01fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x00fe, 0x0180, 0x0180, 0x0180,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // '6'
+    0x0000, 0x0000, 0x0000, 0x00f8, 0x000c, 0x0006, 0x0006, 0x0006, 0x00fe, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // '7'
+    0x0000, 0x0000, 0x0000, 0x01fe, 0x0186, 0x0186, 0x0180, 0x00c0, 0x00c0, 0x0060, 0x0060, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // '8'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0186, 0x0186, 0x00fc, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // '9'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x01fc, 0x0180, 0x0180,
+    0x0180, 0x00c0, 0x007c, 0x0000, 0x0000, 0x0000,
+    // ':'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ';'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0030, 0x0030, 0x0030, 0x0018, 0x0000, 0x0000,
+    // '<'
+    0x0000, 0x0000, 0x0000, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x0006, 0x000c, 0x0018,
+    0x0030, 0x0060, 0x00c0, 0x0000, 0x0000, 0x0000,
+    // '='
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '>'
+    0x0000, 0x0000, 0x0000, 0x0006, 0x000c, 0x0018, 0x0030, 0x0060, 0x00c0, 0x00c0, 0x0060, 0x0030,
+    0x0018, 0x000c, 0x0006, 0x0000, 0x0000, 0x0000,
+    // '?'
+    0x0000, 0x0000, 0x0000, 0x0078, 0x00cc, 0x0186, 0x0186, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0030,
+    0x0000, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // '@'
+    0x0000, 0x0000, 0x0000, 0x00fe, 0x0183, 0x0183, 0x01f3, 0x019b, 0x019b, 0x019b, 0x019b, 0x01f3,
+    0x0003, 0x0003, 0x01fe, 0x0000, 0x0000, 0x0000,
+    // 'A'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x01fe, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'B'
+    0x0000, 0x0000, 0x0000, 0x00fe, 0x0186, 0x0186, 0x0186, 0x0186, 0x00fe, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x00fe, 0x0000, 0x0000, 0x0000,
+    // 'C'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 'D'
+    0x0000, 0x0000, 0x0000, 0x007e, 0x00c6, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x00c6, 0x007e, 0x0000, 0x0000, 0x0000,
+    // 'E'
+    0x0000, 0x0000, 0x0000, 0x01fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x007e, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x01fe, 0x0000, 0x0000, 0x0000,
+    // 'F'
+    0x0000, 0x0000, 0x0000, 0x01fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x007e, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000,
+    // 'G'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0006, 0x0006, 0x0006, 0x01e6, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 'H'
+    0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x01fe, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'I'
+    0x0000, 0x0000, 0x0000, 0x0078, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0078, 0x0000, 0x0000, 0x0000,
+    // 'J'
+    0x0000, 0x0000, 0x0000, 0x01e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c6,
+    0x00c6, 0x00c6, 0x007c, 0x0000, 0x0000, 0x0000,
+    // 'K'
+    0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x00c6, 0x0066, 0x0036, 0x001e, 0x001e, 0x0036, 0x0066,
+    0x00c6, 0x0186, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'L'
+    0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x01fe, 0x0000, 0x0000, 0x0000,
+    // 'M'
+    0x0000, 0x0000, 0x0000, 0x0101, 0x0183, 0x01c7, 0x01ef, 0x01bb, 0x0193, 0x0183, 0x0183, 0x0183,
+    0x0183, 0x0183, 0x0183, 0x0000, 0x0000, 0x0000,
+    // 'N'
+    0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x0186, 0x018e, 0x019e, 0x01b6, 0x01e6, 0x01c6, 0x0186,
+    0x0186, 0x0186, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'O'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 'P'
+    0x0000, 0x0000, 0x0000, 0x00fe, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x00fe, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000,
+    // 'Q'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x01e6, 0x00fc, 0x00c0, 0x0180, 0x0000,
+    // 'R'
+    0x0000, 0x0000, 0x0000, 0x00fe, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x00fe, 0x001e, 0x0036,
+    0x0066, 0x00c6, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'S'
+    0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0006, 0x0006, 0x00fc, 0x0180, 0x0180, 0x0180,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 'T'
+    0x0000, 0x0000, 0x0000, 0x01fe, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // 'U'
+    0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 'V'
+    0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x0186, 0x0186, 0x00cc, 0x00cc, 0x00cc, 0x00cc, 0x0078,
+    0x0078, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // 'W'
+    0x0000, 0x0000, 0x0000, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0193, 0x01bb, 0x01ef,
+    0x01c7, 0x0183, 0x0101, 0x0000, 0x0000, 0x0000,
+    // 'X'
+    0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x00cc, 0x00cc, 0x0078, 0x0030, 0x0030, 0x0078, 0x00cc,
+    0x00cc, 0x0186, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'Y'
+    0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x0186, 0x00cc, 0x00cc, 0x0078, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // 'Z'
+    0x0000, 0x0000, 0x0000, 0x01fe, 0x0180, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006,
+    0x0006, 0x0006, 0x01fe, 0x0000, 0x0000, 0x0000,
+    // '['
+    0x0000, 0x0000, 0x0000, 0x0078, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0078, 0x0000, 0x0000, 0x0000,
+    // '\\'
+    0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x000c, 0x000c, 0x0018, 0x0018, 0x0030, 0x0030, 0x0060,
+    0x0060, 0x00c0, 0x00c0, 0x0000, 0x0000, 0x0000,
+    // ']'
+    0x0000, 0x0000, 0x0000, 0x0078, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0078, 0x0000, 0x0000, 0x0000,
+    // '^'
+    0x0000, 0x0030, 0x0078, 0x00cc, 0x0186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '_'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0000,
+    // '`'
+    0x0018, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'a'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fc, 0x0180, 0x0180, 0x01fc, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x01fc, 0x0000, 0x0000, 0x0000,
+    // 'b'
+    0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0006, 0x00fe, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x00fe, 0x0000, 0x0000, 0x0000,
+    // 'c'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 'd'
+    0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x01fc, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x01fc, 0x0000, 0x0000, 0x0000,
+    // 'e'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0186, 0x01fe, 0x0006,
+    0x0006, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 'f'
+    0x0000, 0x0000, 0x0000, 0x01e0, 0x0030, 0x0030, 0x00fc, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // 'g'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fc, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x01fc, 0x0180, 0x0180, 0x00fc,
+    // 'h'
+    0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0006, 0x00fe, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'i'
+    0x0000, 0x0000, 0x0000, 0x0030, 0x0030, 0x0000, 0x0038, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0078, 0x0000, 0x0000, 0x0000,
+    // 'j'
+    0x0000, 0x0000, 0x0000, 0x00c0, 0x00c0, 0x0000, 0x00e0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00cc, 0x00cc, 0x0078,
+    // 'k'
+    0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0006, 0x0186, 0x00c6, 0x0066, 0x0036, 0x001e, 0x0036,
+    0x0066, 0x00c6, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'l'
+    0x0000, 0x0000, 0x0000, 0x0038, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0078, 0x0000, 0x0000, 0x0000,
+    // 'm'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01b6, 0x01b6, 0x01b6, 0x01b6, 0x01b6,
+    0x01b6, 0x01b6, 0x01b6, 0x0000, 0x0000, 0x0000,
+    // 'n'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'o'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 'p'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x00fe, 0x0006, 0x0006, 0x0006,
+    // 'q'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fc, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x01fc, 0x0180, 0x0180, 0x0180,
+    // 'r'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f6, 0x001e, 0x000e, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000,
+    // 's'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fc, 0x0186, 0x0006, 0x0006, 0x00fc, 0x0180,
+    0x0180, 0x0186, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 't'
+    0x0000, 0x0000, 0x0000, 0x0018, 0x0018, 0x0018, 0x007e, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x00f0, 0x0000, 0x0000, 0x0000,
+    // 'u'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x01fc, 0x0000, 0x0000, 0x0000,
+    // 'v'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x0186, 0x00cc, 0x00cc, 0x00cc,
+    0x0078, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // 'w'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x0186, 0x01b6, 0x01b6, 0x01b6,
+    0x01b6, 0x01b6, 0x00fc, 0x0000, 0x0000, 0x0000,
+    // 'x'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x00cc, 0x0078, 0x0030, 0x0078,
+    0x00cc, 0x0186, 0x0186, 0x0000, 0x0000, 0x0000,
+    // 'y'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186,
+    0x0186, 0x0186, 0x01fc, 0x0180, 0x0180, 0x00fc,
+    // 'z'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0018,
+    0x000c, 0x0006, 0x01fe, 0x0000, 0x0000, 0x0000,
+    // '{'
+    0x0000, 0x0000, 0x0000, 0x00e0, 0x0030, 0x0030, 0x0030, 0x0030, 0x001c, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x00e0, 0x0000, 0x0000, 0x0000,
+    // '|'
+    0x0000, 0x0000, 0x0000, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000,
+    // '}'
+    0x0000, 0x0000, 0x0000, 0x001c, 0x0030, 0x0030, 0x0030, 0x0030, 0x00e0, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x001c, 0x0000, 0x0000, 0x0000,
+    // '~'
+    0x0000, 0x019c, 0x01b6, 0x01b6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+static const psvs_gui_font_t FONT_TER_U18B = {
+    .width = 9, .height = 18, .rows = FONT_TER_U18B_ROWS
+};
+
+static const unsigned short FONT_TER_U24B_ROWS[GUI_FONT_GLYPHS * 24] = {
+    // ' '
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '!'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '"'
+    0x0000, 0x0000, 0x0198, 0x0198, 0x0198, 0x0198, 0x0198, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '#'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0198, 0x0198, 0x0198, 0x0198, 0x07fe, 0x0198, 0x0198, 0x0198,
+    0x0198, 0x0198, 0x07fe, 0x0198, 0x0198, 0x0198, 0x0198, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '$'
+    0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x01f8, 0x036c, 0x0666, 0x0066, 0x0066, 0x006c, 0x01f8,
+    0x0360, 0x0660, 0x0660, 0x0666, 0x036c, 0x01f8, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '%'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x031c, 0x0336, 0x01b6, 0x019c, 0x00c0, 0x00c0, 0x0060,
+    0x0060, 0x0030, 0x0030, 0x0398, 0x06d8, 0x06cc, 0x038c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '&'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0070, 0x00d8, 0x018c, 0x018c, 0x018c, 0x00d8, 0x0070, 0x0678,
+    0x06cc, 0x0386, 0x0306, 0x0306, 0x0386, 0x06cc, 0x0678, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // "'"
+    0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '('
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00c0, 0x0060, 0x0030, 0x0030, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0030, 0x0030, 0x0060, 0x00c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ')'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0018, 0x0030, 0x0060, 0x0060, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x0060, 0x0060, 0x0030, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '*'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0306, 0x018c, 0x00d8, 0x0070, 0x07ff,
+    0x0070, 0x00d8, 0x018c, 0x0306, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '+'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0060, 0x07fe,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ','
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0060, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '-'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07fe,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '.'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '/'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0180, 0x0180, 0x00c0, 0x00c0, 0x0060,
+    0x0060, 0x0030, 0x0030, 0x0018, 0x0018, 0x000c, 0x000c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '0'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0706, 0x0786, 0x06c6, 0x0666,
+    0x0636, 0x061e, 0x060e, 0x0606, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '1'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0070, 0x0078, 0x006c, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x03fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '2'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0606, 0x0600, 0x0300, 0x0180,
+    0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x07fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '3'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0600, 0x0600, 0x0600, 0x0300, 0x01f0,
+    0x0300, 0x0600, 0x0600, 0x0600, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '4'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0600, 0x0700, 0x0780, 0x06c0, 0x0660, 0x0630, 0x0618, 0x060c,
+    0x0606, 0x0606, 0x0606, 0x07fe, 0x0600, 0x0600, 0x0600, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '5'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x07fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x01fe, 0x0300,
+    0x0600, 0x0600, 0x0600, 0x0600, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '6'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x03f8, 0x000c, 0x0006, 0x0006, 0x0006, 0x0006, 0x01fe, 0x0306,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '7'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x07fe, 0x0606, 0x0606, 0x0600, 0x0300, 0x0300, 0x0180, 0x0180,
+    0x00c0, 0x00c0, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '8'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x01f8,
+    0x030c, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '9'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x060c,
+    0x07f8, 0x0600, 0x0600, 0x0600, 0x0600, 0x0300, 0x01fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ':'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ';'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0060, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '<'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0180, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006,
+    0x000c, 0x0018, 0x0030, 0x0060, 0x00c0, 0x0180, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '='
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07fe, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x07fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '>'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x000c, 0x0018, 0x0030, 0x0060, 0x00c0, 0x0180, 0x0300,
+    0x0180, 0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '?'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0606, 0x0300, 0x0180, 0x00c0,
+    0x0060, 0x0060, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '@'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01fc, 0x0306, 0x0603, 0x07c3, 0x0663, 0x0633, 0x0633, 0x0633,
+    0x0633, 0x0633, 0x0663, 0x07c3, 0x0003, 0x0006, 0x07fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'A'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606,
+    0x07fe, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'B'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0306, 0x0606, 0x0606, 0x0606, 0x0306, 0x01fe, 0x0306,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0306, 0x01fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'C'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0606, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'D'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0306, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0306, 0x01fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'E'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x07fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x01fe,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x07fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'F'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x07fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x01fe,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'G'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0006, 0x0006, 0x0006, 0x07c6,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'H'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x07fe,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'I'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'J'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0fc0, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+    0x0300, 0x0300, 0x0306, 0x0306, 0x0306, 0x018c, 0x00f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'K'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0306, 0x0186, 0x00c6, 0x0066, 0x0036, 0x001e, 0x000e,
+    0x001e, 0x0036, 0x0066, 0x00c6, 0x0186, 0x0306, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'L'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x07fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'M'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0401, 0x0603, 0x0707, 0x078f, 0x06db, 0x0673, 0x0623, 0x0603,
+    0x0603, 0x0603, 0x0603, 0x0603, 0x0603, 0x0603, 0x0603, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'N'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x0606, 0x0606, 0x060e, 0x061e, 0x0636, 0x0666,
+    0x06c6, 0x0786, 0x0706, 0x0606, 0x0606, 0x0606, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'O'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'P'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0306, 0x0606, 0x0606, 0x0606, 0x0606, 0x0306, 0x01fe,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'Q'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0666, 0x03cc, 0x01f8, 0x0300, 0x0600, 0x0000, 0x0000, 0x0000,
+    // 'R'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0306, 0x0606, 0x0606, 0x0606, 0x0606, 0x0306, 0x01fe,
+    0x001e, 0x0036, 0x0066, 0x00c6, 0x0186, 0x0306, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'S'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0006, 0x0006, 0x0006, 0x000c, 0x01f8,
+    0x0300, 0x0600, 0x0600, 0x0600, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'T'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x07fe, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'U'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'V'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x030c, 0x030c, 0x030c,
+    0x0198, 0x0198, 0x0198, 0x00f0, 0x00f0, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'W'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0603, 0x0603, 0x0603, 0x0603, 0x0603, 0x0603, 0x0603, 0x0603,
+    0x0623, 0x0673, 0x06db, 0x078f, 0x0707, 0x0603, 0x0401, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'X'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x030c, 0x030c, 0x0198, 0x0198, 0x00f0, 0x0060,
+    0x00f0, 0x0198, 0x0198, 0x030c, 0x030c, 0x0606, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'Y'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x030c, 0x030c, 0x0198, 0x0198, 0x00f0, 0x00f0,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'Z'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x07fe, 0x0600, 0x0600, 0x0600, 0x0300, 0x0180, 0x00c0, 0x0060,
+    0x0030, 0x0018, 0x000c, 0x0006, 0x0006, 0x0006, 0x07fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '['
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00f8, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x00f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '\\'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000c, 0x000c, 0x0018, 0x0018, 0x0030, 0x0030, 0x0060,
+    0x0060, 0x00c0, 0x00c0, 0x0180, 0x0180, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ']'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00f8, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '^'
+    0x0000, 0x0000, 0x0060, 0x00f0, 0x0198, 0x030c, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '_'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07fe, 0x0000, 0x0000, 0x0000,
+    // '`'
+    0x0018, 0x0030, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'a'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fc, 0x0300, 0x0600, 0x0600,
+    0x07f8, 0x060c, 0x0606, 0x0606, 0x0606, 0x060c, 0x07f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'b'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0006, 0x0006, 0x01fe, 0x0306, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0306, 0x01fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'c'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'd'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0600, 0x0600, 0x0600, 0x0600, 0x07f8, 0x060c, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x060c, 0x07f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'e'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606,
+    0x0606, 0x07fe, 0x0006, 0x0006, 0x0006, 0x060c, 0x03f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'f'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x07c0, 0x0060, 0x0060, 0x0060, 0x03fc, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'g'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07f8, 0x060c, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x070c, 0x07f8, 0x0600, 0x0600, 0x0300, 0x01fc, 0x0000,
+    // 'h'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0006, 0x0006, 0x01fe, 0x0306, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'i'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0000, 0x0078, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'j'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0000, 0x03c0, 0x0300, 0x0300, 0x0300,
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x030c, 0x030c, 0x0198, 0x00f0, 0x0000,
+    // 'k'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x000c, 0x000c, 0x000c, 0x000c, 0x060c, 0x030c, 0x018c, 0x00cc,
+    0x006c, 0x003c, 0x006c, 0x00cc, 0x018c, 0x030c, 0x060c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'l'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0078, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'm'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0366, 0x0666, 0x0666,
+    0x0666, 0x0666, 0x0666, 0x0666, 0x0666, 0x0666, 0x0666, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'n'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0306, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'o'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f8, 0x030c, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x030c, 0x01f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'p'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01fe, 0x0306, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x0306, 0x01fe, 0x0006, 0x0006, 0x0006, 0x0006, 0x0000,
+    // 'q'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07f8, 0x060c, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x060c, 0x07f8, 0x0600, 0x0600, 0x0600, 0x0600, 0x0000,
+    // 'r'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07e6, 0x0036, 0x001e, 0x000e,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 's'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03fc, 0x0606, 0x0006, 0x0006,
+    0x0006, 0x03fc, 0x0600, 0x0600, 0x0600, 0x0606, 0x03fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 't'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0030, 0x0030, 0x0030, 0x0030, 0x01fe, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x03e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'u'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x060c, 0x07f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'v'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x0606, 0x030c,
+    0x030c, 0x0198, 0x0198, 0x00f0, 0x00f0, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'w'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x0606, 0x0606,
+    0x0666, 0x0666, 0x0666, 0x0666, 0x0666, 0x0666, 0x03fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'x'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x030c, 0x0198,
+    0x00f0, 0x0060, 0x00f0, 0x0198, 0x030c, 0x0606, 0x0606, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'y'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0606, 0x0606, 0x0606, 0x0606,
+    0x0606, 0x0606, 0x0606, 0x0606, 0x0606, 0x070c, 0x07f8, 0x0600, 0x0600, 0x0300, 0x01fc, 0x0000,
+    // 'z'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07fe, 0x0600, 0x0300, 0x0180,
+    0x00c0, 0x0060, 0x0030, 0x0018, 0x000c, 0x0006, 0x07fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '{'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01c0, 0x0060, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x001c,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0060, 0x01c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '|'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '}'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x001c, 0x0030, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x01c0,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0030, 0x001c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '~'
+    0x0000, 0x0000, 0x063c, 0x0666, 0x0666, 0x03c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+static const psvs_gui_font_t FONT_TER_U24B = {
+    .width = 12, .height = 24, .rows = FONT_TER_U24B_ROWS
+};
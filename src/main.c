@@ -9,6 +9,12 @@
 #include "gui.h"
 #include "perf.h"
 #include "profile.h"
+#include "capture.h"
+#include "session.h"
+#include "governor.h"
+#include "thermal.h"
+#include "autotune.h"
+#include "procevent.h"
 
 int module_get_offset(SceUID pid, SceUID modid, int segidx, size_t offset, uintptr_t *addr);
 int module_get_export_func(SceUID pid, const char *modname, uint32_t libnid, uint32_t funcnid, uintptr_t *func);
@@ -23,7 +29,6 @@ static SceUID         g_hooks[PSVS_MAX_HOOKS];
 static SceUID         g_injects[1];
 
 static SceUID g_mutex_cpufreq_uid = -1;
-static SceUID g_mutex_procevent_uid = -1;
 static SceUID g_mutex_framebuf_uid = -1;
 static SceUID g_thread_uid = -1;
 static bool   g_thread_run = true;
@@ -54,6 +59,17 @@ int (*_kscePowerSetGpuEs4ClockFrequency)(int a1, int a2);
 int (*_kscePowerSetGpuXbarClockFrequency)(int freq);
 int (*_kscePowerSetVeneziaClockFrequencyForDriver)(int freq);
 
+// Opens log for append, keeps one previous log of up to PSVS_LOG_MAX
+SceUID psvs_log_open(const char *path, const char *path_old) {
+    SceIoStat stat;
+    if (ksceIoGetstat(path, &stat) >= 0 && stat.st_size >= PSVS_LOG_MAX) {
+        ksceIoRemove(path_old);
+        ksceIoRename(path, path_old);
+    }
+
+    return ksceIoOpen(path, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_APPEND, 0777);
+}
+
 static void psvs_input_check(SceCtrlData *pad_data, int count) {
     // Do not pass input to fg app
     if (g_app != PSVS_APP_BLACKLIST && psvs_gui_get_mode() == PSVS_GUI_MODE_FULL) {
@@ -64,6 +80,12 @@ static void psvs_input_check(SceCtrlData *pad_data, int count) {
     }
 }
 
+// Frames and load are needed even with GUI hidden
+static bool psvs_is_measuring() {
+    return psvs_capture_is_running() || psvs_session_is_running()
+            || psvs_governor_is_active() || psvs_autotune_is_running();
+}
+
 int ksceDisplaySetFrameBufInternal_patched(int head, int index, const SceDisplayFrameBuf *pParam, int sync) {
     if (sync == PSVS_FRAMEBUF_HOOK_MAGIC) {
         sync = 1;
@@ -73,8 +95,11 @@ int ksceDisplaySetFrameBufInternal_patched(int head, int index, const SceDisplay
     if (head != ksceDisplayGetPrimaryHead() || !pParam || !pParam->base)
         goto DISPLAY_HOOK_RET;
 
-    if (g_app == PSVS_APP_BLACKLIST)
+    // Blacklisted, or app just changed and g_app is not updated yet
+    if (g_app == PSVS_APP_BLACKLIST || psvs_procevent_is_pending()) {
+        psvs_perf_frame_gap();
         goto DISPLAY_HOOK_RET;
+    }
 
     if (!index && g_app == PSVS_APP_SCESHELL)
         goto DISPLAY_HOOK_RET; // Do not draw on i0 in SceShell
@@ -83,19 +108,26 @@ int ksceDisplaySetFrameBufInternal_patched(int head, int index, const SceDisplay
         goto DISPLAY_HOOK_RET; // Do not draw over SceShell overlay
 
     psvs_gui_mode_t mode = psvs_gui_get_mode();
-    if (mode == PSVS_GUI_MODE_HIDDEN)
+    if (mode == PSVS_GUI_MODE_HIDDEN && !psvs_is_measuring()) {
+        psvs_perf_frame_gap();
         goto DISPLAY_HOOK_RET;
+    }
 
     int ret = ksceKernelLockMutex(g_mutex_framebuf_uid, 1, NULL);
     if (ret < 0)
         goto DISPLAY_HOOK_RET;
 
-    psvs_perf_calc_fps();
+    psvs_perf_calc_fps(index, pParam->base);
+    psvs_capture_frame();
 
     if (mode == PSVS_GUI_MODE_FULL)
         psvs_perf_poll_memory();
 
-    psvs_gui_set_framebuf(pParam);
+    if (!psvs_gui_set_framebuf(pParam)) {
+        // Unsupported pixelformat, don't draw garbage
+        ksceKernelUnlockMutex(g_mutex_framebuf_uid, 1);
+        goto DISPLAY_HOOK_RET;
+    }
 
     if (mode == PSVS_GUI_MODE_FPS || mode == PSVS_GUI_MODE_FULL || mode == PSVS_GUI_MODE_FPS_BATTERY) {
         psvs_gui_dd_fps(); // draw fps onto fb
@@ -144,30 +176,43 @@ int kscePowerSetArmClockFrequency_patched(int freq) {
         TAI_CONTINUE(int, g_hookrefs[9], 444);
         psvs_oc_holy_shit();
         ret = 0;
+        freq = 500;
     } else {
         ret = TAI_CONTINUE(int, g_hookrefs[9], freq);
     }
+    psvs_oc_set_shadow_freq(PSVS_OC_DEVICE_CPU, ret < 0 ? 0 : freq);
 
     ksceKernelUnlockMutex(g_mutex_cpufreq_uid, 1);
     return ret;
 }
 
 int kscePowerSetBusClockFrequency_patched(int freq) {
-    return TAI_CONTINUE(int, g_hookrefs[10], psvs_oc_get_target_freq(PSVS_OC_DEVICE_BUS, freq));
+    freq = psvs_oc_get_target_freq(PSVS_OC_DEVICE_BUS, freq);
+    int ret = TAI_CONTINUE(int, g_hookrefs[10], freq);
+    psvs_oc_set_shadow_freq(PSVS_OC_DEVICE_BUS, ret < 0 ? 0 : freq);
+    return ret;
 }
 
 int kscePowerSetGpuEs4ClockFrequency_patched(int a1, int a2) {
     a1 = psvs_oc_get_target_freq(PSVS_OC_DEVICE_GPU_ES4, a1);
     a2 = psvs_oc_get_target_freq(PSVS_OC_DEVICE_GPU_ES4, a2);
-    return TAI_CONTINUE(int, g_hookrefs[11], a1, a2);
+    int ret = TAI_CONTINUE(int, g_hookrefs[11], a1, a2);
+    psvs_oc_set_shadow_freq(PSVS_OC_DEVICE_GPU_ES4, ret < 0 ? 0 : a1);
+    return ret;
 }
 
 int kscePowerSetGpuXbarClockFrequency_patched(int freq) {
-    return TAI_CONTINUE(int, g_hookrefs[12], psvs_oc_get_target_freq(PSVS_OC_DEVICE_GPU_XBAR, freq));
+    freq = psvs_oc_get_target_freq(PSVS_OC_DEVICE_GPU_XBAR, freq);
+    int ret = TAI_CONTINUE(int, g_hookrefs[12], freq);
+    psvs_oc_set_shadow_freq(PSVS_OC_DEVICE_GPU_XBAR, ret < 0 ? 0 : freq);
+    return ret;
 }
 
 int kscePowerSetVeneziaClockFrequencyForDriver_patched(int freq) {
-    return TAI_CONTINUE(int, g_hookrefs[18], psvs_oc_get_target_freq(PSVS_OC_DEVICE_VENEZIA, freq));
+    freq = psvs_oc_get_target_freq(PSVS_OC_DEVICE_VENEZIA, freq);
+    int ret = TAI_CONTINUE(int, g_hookrefs[18], freq);
+    psvs_oc_set_shadow_freq(PSVS_OC_DEVICE_VENEZIA, ret < 0 ? 0 : freq);
+    return ret;
 }
 
 DECL_FUNC_HOOK_PATCH_FREQ_GETTER(14, scePowerGetArmClockFrequency,     PSVS_OC_DEVICE_CPU)
@@ -175,93 +220,12 @@ DECL_FUNC_HOOK_PATCH_FREQ_GETTER(15, scePowerGetBusClockFrequency,     PSVS_OC_D
 DECL_FUNC_HOOK_PATCH_FREQ_GETTER(16, scePowerGetGpuClockFrequency,     PSVS_OC_DEVICE_GPU_ES4)
 DECL_FUNC_HOOK_PATCH_FREQ_GETTER(17, scePowerGetGpuXbarClockFrequency, PSVS_OC_DEVICE_GPU_XBAR)
 
-static psvs_app_t _psvs_get_app_type(int pid, const char *titleid) {
-    psvs_app_t app = PSVS_APP_MAX;
-
-    if (ksceSblACMgrIsPspEmu(pid)) {
-        app = PSVS_APP_BLACKLIST;
-    } else if (!strncmp(titleid, "NPXS", 4)) {
-        app = PSVS_APP_SYSTEM;
-
-        // TODO: Figure out a way to do this on the fly
-
-        if (!strncmp(&titleid[4], "10079", 5) ||     // Daily Checker BG
-                !strncmp(&titleid[4], "10063", 5)) { // MsgMW
-            app = PSVS_APP_MAX; // not an app
-        } else if (!strncmp(&titleid[4], "10007", 5) || // Welcome Park
-                   !strncmp(&titleid[4], "10010", 5) || // Videos
-                   !strncmp(&titleid[4], "10026", 5) || // Content Manager
-                   !strncmp(&titleid[4], "10095", 5)) { // Panoramic Camera
-            app = PSVS_APP_SYSTEM_XCL; // exclusive
-        }
-    } else if (ksceSblACMgrIsSceShell(pid) && !strncmp(titleid, "main", 4)) {
-        app = PSVS_APP_SCESHELL;
-    } else {
-        app = PSVS_APP_GAME;
-    }
-
-    return app;
-}
-
+// Only queue the event, profile is applied by procevent worker off the launch path
 int ksceKernelInvokeProcEventHandler_patched(int pid, int ev, int a3, int a4, int *a5, int a6) {
-    char titleid[sizeof(g_titleid)];
-    psvs_app_t app = PSVS_APP_SCESHELL;
-
-    int ret = ksceKernelLockMutex(g_mutex_procevent_uid, 1, NULL);
-    if (ret < 0)
-        goto PROCEVENT_EXIT;
-
-    switch (ev) {
-        case 1: // startup
-        case 5: // resume
-            // Ignore startup events if non-SceShell app is running
-            if (g_app != PSVS_APP_SCESHELL)
-                goto PROCEVENT_UNLOCK_EXIT;
-
-            // Check titleid
-            ksceKernelGetProcessTitleId(pid, titleid, sizeof(titleid));
-
-            // Check app type
-            app = _psvs_get_app_type(pid, titleid);
-            if (app == PSVS_APP_MAX) // not an app
-                goto PROCEVENT_UNLOCK_EXIT;
-
-            break;
-
-        case 3: // exit
-        case 4: // suspend
-            if (g_pid != pid)
-                goto PROCEVENT_UNLOCK_EXIT;
-
-            app = PSVS_APP_SCESHELL;
-            snprintf(titleid, sizeof(titleid), "main");
-            break;
-    }
+    if (ev == PSVS_PROCEVENT_STARTUP || ev == PSVS_PROCEVENT_EXIT
+            || ev == PSVS_PROCEVENT_SUSPEND || ev == PSVS_PROCEVENT_RESUME)
+        psvs_procevent_push(pid, ev);
 
-    if (ev == 1 || ev == 5 || ev == 3 || ev == 4) {
-        if (strncmp(g_titleid, titleid, sizeof(g_titleid))) {
-            // Set titleid
-            strncpy(g_titleid, titleid, sizeof(g_titleid));
-
-            // Set pid
-            g_pid = (ev == 1 || ev == 5) ? pid : INVALID_PID;
-
-            // Set type
-            g_app = app;
-
-            // Load profile
-            if (g_app == PSVS_APP_BLACKLIST || !psvs_profile_load()) {
-                // If no profile exists or in blacklisted app,
-                // reset all options to default
-                psvs_oc_init();
-            }
-        }
-    }
-
-PROCEVENT_UNLOCK_EXIT:
-    ksceKernelUnlockMutex(g_mutex_procevent_uid, 1);
-
-PROCEVENT_EXIT:
     return TAI_CONTINUE(int, g_hookrefs[13], pid, ev, a3, a4, a5, a6);
 }
 
@@ -284,11 +248,20 @@ static int psvs_thread(SceSize args, void *argp) {
         bool fb_or_mode_changed = psvs_gui_mode_changed() || psvs_gui_fb_res_changed();
         psvs_gui_mode_t mode = psvs_gui_get_mode();
 
-        // If in OSD/FULL mode, poll shown info
-        if (mode == PSVS_GUI_MODE_OSD || mode == PSVS_GUI_MODE_FULL) {
+        // If in OSD/FULL mode, measuring or governing, poll shown info
+        if (mode == PSVS_GUI_MODE_OSD || mode == PSVS_GUI_MODE_FULL
+                || psvs_is_measuring()) {
             psvs_perf_poll_cpu();
             psvs_perf_poll_batt();
+        } else if (psvs_thermal_is_active()) {
+            psvs_perf_poll_batt();
         }
+        psvs_capture_sample();
+        psvs_session_update();
+        psvs_governor_update();
+        psvs_thermal_update();
+        psvs_autotune_update();
+        psvs_oc_check_shadow();
 
         // Redraw buffer template on gui mode or fb change
         if (fb_or_mode_changed) {
@@ -304,6 +277,9 @@ static int psvs_thread(SceSize args, void *argp) {
             psvs_gui_draw_osd_cpu();
             psvs_gui_draw_osd_fps();
             psvs_gui_draw_osd_batt();
+            psvs_gui_draw_osd_graph();
+            psvs_gui_draw_osd_stutter();
+            psvs_gui_draw_osd_rates();
         }
 
         // Draw FULL mode
@@ -312,9 +288,14 @@ static int psvs_thread(SceSize args, void *argp) {
             psvs_gui_draw_batt_section();
             psvs_gui_draw_cpu_section();
             psvs_gui_draw_memory_section();
+            psvs_gui_draw_graph_section();
             psvs_gui_draw_menu();
         }
 
+        // Show what has been drawn
+        if (mode == PSVS_GUI_MODE_OSD || mode == PSVS_GUI_MODE_FULL)
+            psvs_gui_flip();
+
         ksceKernelDelayThread(50 * 1000);
     }
 
@@ -328,8 +309,14 @@ int module_start(SceSize argc, const void *args) {
     if (ksceSblAimgrIsGenuineDolce())
         g_is_dolce = true;
 
+    psvs_perf_init();
     psvs_gui_init();
     psvs_profile_init();
+    psvs_capture_init();
+    psvs_session_init();
+    psvs_thermal_init();
+    psvs_autotune_init();
+    psvs_procevent_init();
 
     tai_module_info_t tai_info;
     tai_info.size = sizeof(tai_module_info_t);
@@ -362,9 +349,9 @@ int module_start(SceSize argc, const void *args) {
             "ScePower", 0x1590166F, 0x621BD8FD, (uintptr_t *)&_kscePowerSetVeneziaClockFrequencyForDriver);
 
     g_mutex_cpufreq_uid = ksceKernelCreateMutex("psvs_mutex_cpufreq", 0, 0, NULL);
-    g_mutex_procevent_uid = ksceKernelCreateMutex("psvs_mutex_procevent", 0, 0, NULL);
     g_mutex_framebuf_uid = ksceKernelCreateMutex("psvs_mutex_framebuf", 0, 0, NULL);
 
+    psvs_oc_setup();
     psvs_oc_init(); // reset profile options to default
 
     g_hooks[0] = taiHookFunctionExportForKernel(KERNEL_PID, &g_hookrefs[0],
@@ -427,7 +414,7 @@ int module_start(SceSize argc, const void *args) {
 
     // Load main profile
     snprintf(g_titleid, sizeof(g_titleid), "main");
-    psvs_profile_load();
+    psvs_profile_load(NULL);
 
     g_thread_uid = ksceKernelCreateThread("psvs_thread", psvs_thread, 0x3C, 0x3000, 0, 0x10000, 0);
     ksceKernelStartThread(g_thread_uid, 0, NULL);
@@ -452,11 +439,14 @@ int module_stop(SceSize argc, const void *args) {
 
     if (g_mutex_cpufreq_uid >= 0)
         ksceKernelDeleteMutex(g_mutex_cpufreq_uid);
-    if (g_mutex_procevent_uid >= 0)
-        ksceKernelDeleteMutex(g_mutex_procevent_uid);
     if (g_mutex_framebuf_uid >= 0)
         ksceKernelDeleteMutex(g_mutex_framebuf_uid);
 
+    psvs_procevent_deinit();
+    psvs_oc_teardown();
+    psvs_capture_deinit();
+    psvs_session_deinit();
+    psvs_profile_deinit();
     psvs_gui_deinit();
 
     return SCE_KERNEL_STOP_SUCCESS;
@@ -3,7 +3,7 @@
 #include "perf.h"
 
 #define PSVS_VERSION_STRING "PSVshell v1.3 beta"
-#define PSVS_VERSION_VER    "PSVS0110"
+#define PSVS_VERSION_VER    "PSVS0120"
 
 #define DECL_FUNC_HOOK_PATCH_CTRL(index, name) \
     static int name##_patched(int port, SceCtrlData *pad_data, int count) { \
@@ -17,8 +17,8 @@
     static int name##_patched() { \
         uint32_t state; \
         ENTER_SYSCALL(state); \
-        TAI_CONTINUE(int, g_hookrefs[(index)]); \
-        int freq = psvs_oc_get_freq((device));  \
+        TAI_CONTINUE(int, g_hookrefs[(index)]); /* keep the hook chain */ \
+        int freq = psvs_oc_get_freq((device)); /* shadow, may lag ScePower by up to 2s */ \
         EXIT_SYSCALL(state); \
         return freq; \
     }
@@ -34,6 +34,9 @@
 
 #define PSVS_FRAMEBUF_HOOK_MAGIC 0x7183015
 
+// Append-only logs are moved to `path_old` once they reach this size
+#define PSVS_LOG_MAX (64 * 1024)
+
 typedef enum {
     PSVS_APP_SCESHELL,
     PSVS_APP_SYSTEM,
@@ -49,6 +52,8 @@ extern char g_titleid[32];
 
 extern bool g_is_dolce;
 
+SceUID psvs_log_open(const char *path, const char *path_old);
+
 extern int (*SceSysmemForKernel_0x3650963F)(uint32_t a1, SceSysmemAddressSpaceInfo *a2);
 extern int (*SceThreadmgrForDriver_0x7E280B69)(SceKernelSystemInfo *pInfo);
 extern int (*ScePervasiveForDriver_0xE9D95643)(int mul, int ndiv);
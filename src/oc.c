@@ -6,6 +6,8 @@
 #include "main.h"
 #include "oc.h"
 
+SceUInt32 ksceKernelGetProcessTimeLowCore();
+
 // Declare helper getter/setter for GpuEs4
 static int __kscePowerGetGpuEs4ClockFrequency() {
     int a1, a2;
@@ -30,27 +32,32 @@ static psvs_oc_devopt_t g_oc_devopt[PSVS_OC_DEVICE_MAX] = {
     [PSVS_OC_DEVICE_CPU] = {
         .freq_n = 8, .freq = {41, 83, 111, 166, 222, 333, 444, 500}, .default_freq = 333,
         .get_freq = __kscePowerGetArmClockFrequency,
-        .set_freq = __kscePowerSetArmClockFrequency
+        .set_freq = __kscePowerSetArmClockFrequency,
+        .name = "cpu"
     },
     [PSVS_OC_DEVICE_GPU_ES4] = {
         .freq_n = 6, .freq = {41, 55, 83, 111, 166, 222}, .default_freq = 111,
         .get_freq = __kscePowerGetGpuEs4ClockFrequency,
-        .set_freq = __kscePowerSetGpuEs4ClockFrequency
+        .set_freq = __kscePowerSetGpuEs4ClockFrequency,
+        .name = "es4"
     },
     [PSVS_OC_DEVICE_BUS] = {
         .freq_n = 5, .freq = {55, 83, 111, 166, 222}, .default_freq = 222,
         .get_freq = __kscePowerGetBusClockFrequency,
-        .set_freq = __kscePowerSetBusClockFrequency
+        .set_freq = __kscePowerSetBusClockFrequency,
+        .name = "bus"
     },
     [PSVS_OC_DEVICE_GPU_XBAR] = {
         .freq_n = 3, .freq = {83, 111, 166}, .default_freq = 111,
         .get_freq = __kscePowerGetGpuXbarClockFrequency,
-        .set_freq = __kscePowerSetGpuXbarClockFrequency
+        .set_freq = __kscePowerSetGpuXbarClockFrequency,
+        .name = "xbar"
     },
     [PSVS_OC_DEVICE_VENEZIA] = {
         .freq_n = 7, .freq = {41, 55, 83, 111, 166, 222, 333}, .default_freq = 166,
         .get_freq = __kscePowerGetVeneziaClockFrequencyForDriver,
-        .set_freq = __kscePowerSetVeneziaClockFrequencyForDriver
+        .set_freq = __kscePowerSetVeneziaClockFrequencyForDriver,
+        .name = "vnz"
     },
 };
 
@@ -60,13 +67,121 @@ static psvs_oc_profile_t g_oc = {
     .manual_freq = {0}
 };
 static bool g_oc_has_changed = true;
+static int g_oc_governor_freq[PSVS_OC_DEVICE_MAX] = {0}; // not part of profile
+static int g_oc_ceiling[PSVS_OC_DEVICE_MAX] = {0};       // thermal, 0 = none
+
+// Raise interconnect before its clients, lower in reverse
+static const psvs_oc_device_t g_oc_raise_order[PSVS_OC_DEVICE_MAX] = {
+    PSVS_OC_DEVICE_BUS,
+    PSVS_OC_DEVICE_GPU_XBAR,
+    PSVS_OC_DEVICE_GPU_ES4,
+    PSVS_OC_DEVICE_VENEZIA,
+    PSVS_OC_DEVICE_CPU
+};
+static SceUID g_oc_transition_mutex_uid = -1; // procevent worker vs psvs_thread
+
+// Clocks as last set through the hooks, 0 = unknown, read hardware
+static int g_oc_shadow_freq[PSVS_OC_DEVICE_MAX] = {0};
+static SceUInt32 g_oc_shadow_tick = 0; // last check against hardware
+
+static int _psvs_oc_read_freq(psvs_oc_device_t device) {
+    int freq = g_oc_devopt[device].get_freq();
+    __atomic_store_n(&g_oc_shadow_freq[device], freq > 0 ? freq : 0, __ATOMIC_RELAXED);
+    return freq;
+}
 
 int psvs_oc_get_freq(psvs_oc_device_t device) {
-    return g_oc_devopt[device].get_freq();
+    int freq = psvs_oc_get_shadow_freq(device);
+    return freq ? freq : _psvs_oc_read_freq(device);
+}
+
+int psvs_oc_get_shadow_freq(psvs_oc_device_t device) {
+    return __atomic_load_n(&g_oc_shadow_freq[device], __ATOMIC_RELAXED);
+}
+
+// Called from set hooks with the clock just applied, 0 = failed
+void psvs_oc_set_shadow_freq(psvs_oc_device_t device, int freq) {
+    // ScePower may round clocks not in the table, let the next get read it
+    bool valid = false;
+    for (int i = 0; i < g_oc_devopt[device].freq_n; i++) {
+        if (freq == g_oc_devopt[device].freq[i]) {
+            valid = true;
+            break;
+        }
+    }
+
+    __atomic_store_n(&g_oc_shadow_freq[device], valid ? freq : 0, __ATOMIC_RELAXED);
+}
+
+// Called from psvs_thread, ScePower may change clocks behind our hooks
+void psvs_oc_check_shadow() {
+    SceUInt32 tick_now = ksceKernelGetProcessTimeLowCore();
+    if (tick_now - g_oc_shadow_tick < PSVS_OC_SHADOW_CHECK_INTERVAL)
+        return;
+    g_oc_shadow_tick = tick_now;
+
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++)
+        _psvs_oc_read_freq(i);
+}
+
+const char *psvs_oc_get_name(psvs_oc_device_t device) {
+    return g_oc_devopt[device].name;
+}
+
+const int *psvs_oc_get_freq_table(psvs_oc_device_t device, int *freq_n) {
+    *freq_n = g_oc_devopt[device].freq_n;
+    return g_oc_devopt[device].freq;
 }
 
 int psvs_oc_set_freq(psvs_oc_device_t device, int freq) {
-    return g_oc_devopt[device].set_freq(freq);
+    // Set hook stores the clock it really applied
+    __atomic_store_n(&g_oc_shadow_freq[device], 0, __ATOMIC_RELAXED);
+    int ret = g_oc_devopt[device].set_freq(freq);
+    if (ret >= 0 && !psvs_oc_get_shadow_freq(device))
+        psvs_oc_set_shadow_freq(device, freq); // not hooked yet
+    return ret;
+}
+
+static void _psvs_oc_transition_step(psvs_oc_transition_t *transition, psvs_oc_device_t device) {
+    SceUInt32 tick = ksceKernelGetProcessTimeLowCore();
+    psvs_oc_set_freq(device, transition->to[device]);
+    transition->time[device] = ksceKernelGetProcessTimeLowCore() - tick;
+    if (!transition->time[device])
+        transition->time[device] = 1; // 0 means skipped
+    transition->changed_n++;
+}
+
+// Moves all devices to freq[] at once, 0 = leave device alone.
+// Devices already there are skipped, lowering goes before raising
+// so the interconnect is never slower than what it feeds.
+// Timings go to caller's transition. Returns number of devices changed.
+int psvs_oc_transition(const int freq[PSVS_OC_DEVICE_MAX], psvs_oc_transition_t *transition) {
+    memset(transition, 0, sizeof(psvs_oc_transition_t));
+
+    // One transition at a time, or their steps interleave
+    ksceKernelLockMutex(g_oc_transition_mutex_uid, 1, NULL);
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        if (!freq[i])
+            continue;
+        // From hardware, a stale shadow clock must not skip a change
+        transition->from[i] = _psvs_oc_read_freq(i);
+        if (transition->from[i] != freq[i])
+            transition->to[i] = freq[i];
+    }
+
+    for (int i = PSVS_OC_DEVICE_MAX - 1; i >= 0; i--) {
+        psvs_oc_device_t device = g_oc_raise_order[i];
+        if (transition->to[device] && transition->to[device] < transition->from[device])
+            _psvs_oc_transition_step(transition, device);
+    }
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        psvs_oc_device_t device = g_oc_raise_order[i];
+        if (transition->to[device] > transition->from[device])
+            _psvs_oc_transition_step(transition, device);
+    }
+    ksceKernelUnlockMutex(g_oc_transition_mutex_uid, 1);
+
+    return transition->changed_n;
 }
 
 void psvs_oc_holy_shit() {
@@ -79,18 +194,42 @@ void psvs_oc_holy_shit() {
 }
 
 int psvs_oc_get_target_freq(psvs_oc_device_t device, int default_freq) {
+    int freq;
     if (g_oc.mode[device] == PSVS_OC_MODE_MANUAL)
-        return g_oc.manual_freq[device];
-    return default_freq;
+        freq = g_oc.manual_freq[device];
+    else if (g_oc.mode[device] == PSVS_OC_MODE_GOVERNOR)
+        freq = g_oc_governor_freq[device];
+    else
+        return default_freq;
+
+    // Thermal ceiling
+    if (g_oc_ceiling[device] && freq > g_oc_ceiling[device])
+        freq = g_oc_ceiling[device];
+    return freq;
+}
+
+// Clock the device should run at in its current mode
+static int _psvs_oc_get_mode_freq(psvs_oc_device_t device) {
+    // Manual/governor clocks
+    if (g_oc.mode[device] == PSVS_OC_MODE_MANUAL || g_oc.mode[device] == PSVS_OC_MODE_GOVERNOR)
+        return psvs_oc_get_target_freq(device, 0);
+    // Default clocks
+    return psvs_oc_get_default_freq(device);
+}
+
+// Moves devices in mask to their mode clocks in one transition
+static void _psvs_oc_apply_mode_freq(uint32_t device_mask) {
+    psvs_oc_transition_t transition;
+    int freq[PSVS_OC_DEVICE_MAX] = {0};
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        if (device_mask & (1 << i))
+            freq[i] = _psvs_oc_get_mode_freq(i);
+    }
+    psvs_oc_transition(freq, &transition);
 }
 
 void psvs_oc_set_target_freq(psvs_oc_device_t device) {
-    // Refresh manual clocks
-    if (g_oc.mode[device] == PSVS_OC_MODE_MANUAL)
-        psvs_oc_set_freq(device, g_oc.manual_freq[device]);
-    // Restore default clocks
-    else if (g_oc.mode[device] == PSVS_OC_MODE_DEFAULT)
-        psvs_oc_set_freq(device, psvs_oc_get_default_freq(device));
+    _psvs_oc_apply_mode_freq(1 << device);
 }
 
 psvs_oc_mode_t psvs_oc_get_mode(psvs_oc_device_t device) {
@@ -98,6 +237,10 @@ psvs_oc_mode_t psvs_oc_get_mode(psvs_oc_device_t device) {
 }
 
 void psvs_oc_set_mode(psvs_oc_device_t device, psvs_oc_mode_t mode) {
+    // Governor starts from current clock
+    if (mode == PSVS_OC_MODE_GOVERNOR && g_oc.mode[device] != PSVS_OC_MODE_GOVERNOR)
+        g_oc_governor_freq[device] = psvs_oc_get_freq(device);
+
     g_oc.mode[device] = mode;
     g_oc_has_changed = true;
     psvs_oc_set_target_freq(device);
@@ -107,12 +250,20 @@ psvs_oc_profile_t *psvs_oc_get_profile() {
     return &g_oc;
 }
 
-void psvs_oc_set_profile(psvs_oc_profile_t *oc) {
+// Applies profile clocks, transition gets their timings if not NULL
+void psvs_oc_set_profile(psvs_oc_profile_t *oc, psvs_oc_transition_t *transition) {
+    psvs_oc_transition_t local;
     memcpy(&g_oc, oc, sizeof(psvs_oc_profile_t));
     g_oc_has_changed = false;
 
-    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++)
-        psvs_oc_set_target_freq(i);
+    int freq[PSVS_OC_DEVICE_MAX];
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        // Governor starts from app's default clock
+        if (g_oc.mode[i] == PSVS_OC_MODE_GOVERNOR)
+            g_oc_governor_freq[i] = psvs_oc_get_default_freq(i);
+        freq[i] = _psvs_oc_get_mode_freq(i);
+    }
+    psvs_oc_transition(freq, transition ? transition : &local);
 }
 
 bool psvs_oc_has_changed() {
@@ -126,7 +277,8 @@ void psvs_oc_set_changed(bool changed) {
 int psvs_oc_get_default_freq(psvs_oc_device_t device) {
     int freq = g_oc_devopt[device].default_freq;
 
-    if (g_pid == INVALID_PID)
+    // No Venezia clock in app's ScePower storage
+    if (g_pid == INVALID_PID || device == PSVS_OC_DEVICE_VENEZIA)
         return freq;
 
     uintptr_t pstorage = 0;
@@ -176,11 +328,94 @@ void psvs_oc_change_manual(psvs_oc_device_t device, bool raise_freq) {
 
     // Refresh manual clocks
     if (g_oc.mode[device] == PSVS_OC_MODE_MANUAL)
-        psvs_oc_set_freq(device, g_oc.manual_freq[device]);
+        psvs_oc_set_target_freq(device);
+}
+
+int psvs_oc_get_governor_freq(psvs_oc_device_t device) {
+    return g_oc_governor_freq[device];
+}
+
+void psvs_oc_set_governor_freq(psvs_oc_device_t device, int freq) {
+    g_oc_governor_freq[device] = freq;
+
+    // Refresh governor clocks
+    if (g_oc.mode[device] == PSVS_OC_MODE_GOVERNOR)
+        psvs_oc_set_target_freq(device);
+}
+
+int psvs_oc_get_ceiling(psvs_oc_device_t device) {
+    return g_oc_ceiling[device];
+}
+
+// All ceilings at once, changed devices move in one ordered transition
+void psvs_oc_set_ceilings(const int freq[PSVS_OC_DEVICE_MAX]) {
+    uint32_t device_mask = 0;
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        if (g_oc_ceiling[i] != freq[i]) {
+            g_oc_ceiling[i] = freq[i];
+            device_mask |= 1 << i;
+        }
+    }
+
+    if (device_mask)
+        _psvs_oc_apply_mode_freq(device_mask);
+}
+
+int psvs_oc_get_target_fps() {
+    return g_oc.target_fps;
+}
+
+void psvs_oc_change_target_fps(bool raise_fps) {
+    int fps = g_oc.target_fps + (raise_fps ? PSVS_OC_TARGET_FPS_STEP : -PSVS_OC_TARGET_FPS_STEP);
+    if (fps < PSVS_OC_TARGET_FPS_MIN)
+        fps = PSVS_OC_TARGET_FPS_MIN;
+    if (fps > PSVS_OC_TARGET_FPS_MAX)
+        fps = PSVS_OC_TARGET_FPS_MAX;
+
+    if (fps != g_oc.target_fps) {
+        g_oc.target_fps = fps;
+        g_oc_has_changed = true;
+    }
+}
+
+void psvs_oc_set_manual(psvs_oc_device_t device, int freq) {
+    g_oc.manual_freq[device] = freq;
+    g_oc_has_changed = true;
+
+    // Refresh manual clocks
+    if (g_oc.mode[device] == PSVS_OC_MODE_MANUAL)
+        psvs_oc_set_target_freq(device);
+}
+
+// Several manual clocks at once, 0 = leave device alone
+void psvs_oc_set_manual_freqs(const int freq[PSVS_OC_DEVICE_MAX]) {
+    uint32_t device_mask = 0;
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        if (!freq[i])
+            continue;
+        g_oc.manual_freq[i] = freq[i];
+        g_oc_has_changed = true;
+        if (g_oc.mode[i] == PSVS_OC_MODE_MANUAL)
+            device_mask |= 1 << i;
+    }
+
+    // Refresh manual clocks
+    if (device_mask)
+        _psvs_oc_apply_mode_freq(device_mask);
+}
+
+void psvs_oc_setup() {
+    g_oc_transition_mutex_uid = ksceKernelCreateMutex("psvs_mutex_oc_transition", 0, 0, NULL);
+}
+
+void psvs_oc_teardown() {
+    if (g_oc_transition_mutex_uid >= 0)
+        ksceKernelDeleteMutex(g_oc_transition_mutex_uid);
 }
 
 void psvs_oc_init() {
     g_oc_has_changed = true;
+    g_oc.target_fps = PSVS_OC_TARGET_FPS_DEFAULT;
     for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
         g_oc.mode[i] = PSVS_OC_MODE_DEFAULT;
         psvs_oc_reset_manual(i);
@@ -2,6 +2,7 @@
 #define _OC_H_
 
 #define PSVS_OC_MAX_FREQ_N 10
+#define PSVS_OC_SHADOW_CHECK_INTERVAL 2000 * 1000 // us, shadow clocks vs hardware
 
 #define PSVS_OC_DECL_SETTER(fun) \
     static int _##fun(int freq) { return fun(freq); }
@@ -20,35 +21,57 @@ typedef enum {
 typedef enum {
     PSVS_OC_MODE_DEFAULT,
     PSVS_OC_MODE_MANUAL,
+    PSVS_OC_MODE_GOVERNOR, // lowest clock that holds target_fps
     PSVS_OC_MODE_MAX
 } psvs_oc_mode_t;
 
+#define PSVS_OC_TARGET_FPS_MIN 10
+#define PSVS_OC_TARGET_FPS_MAX 60
+#define PSVS_OC_TARGET_FPS_STEP 5
+#define PSVS_OC_TARGET_FPS_DEFAULT 30
+
 typedef struct {
     char ver[8];
     psvs_oc_mode_t mode[PSVS_OC_DEVICE_MAX];
     int manual_freq[PSVS_OC_DEVICE_MAX];
+    int target_fps; // for PSVS_OC_MODE_GOVERNOR
 } psvs_oc_profile_t;
 
+// Batch clock change, see psvs_oc_transition()
+typedef struct {
+    int from[PSVS_OC_DEVICE_MAX];
+    int to[PSVS_OC_DEVICE_MAX];      // 0 = left alone
+    uint32_t time[PSVS_OC_DEVICE_MAX]; // us spent in setter, 0 if skipped
+    int changed_n;
+} psvs_oc_transition_t;
+
 typedef struct {
     const int freq[PSVS_OC_MAX_FREQ_N];
     const int freq_n;
     const int default_freq;
     int (*get_freq)();
     int (*set_freq)(int freq);
+    const char *name;
 } psvs_oc_devopt_t;
 
 int psvs_oc_get_freq(psvs_oc_device_t device);
+const char *psvs_oc_get_name(psvs_oc_device_t device);
+int psvs_oc_get_shadow_freq(psvs_oc_device_t device);
+void psvs_oc_set_shadow_freq(psvs_oc_device_t device, int freq);
+void psvs_oc_check_shadow();
+const int *psvs_oc_get_freq_table(psvs_oc_device_t device, int *freq_n);
 int psvs_oc_set_freq(psvs_oc_device_t device, int freq);
 void psvs_oc_holy_shit();
+int psvs_oc_transition(const int freq[PSVS_OC_DEVICE_MAX], psvs_oc_transition_t *transition);
 
 int psvs_oc_get_target_freq(psvs_oc_device_t device, int default_freq);
-void psvs_oc_set_target_freq(psvs_oc_device_t device);
+void psvs_oc_set_target_freq(psvs_oc_device_t device); // via psvs_oc_transition()
 psvs_oc_mode_t psvs_oc_get_mode(psvs_oc_device_t device);
 void psvs_oc_set_mode(psvs_oc_device_t device, psvs_oc_mode_t mode);
 
 // profiles
 psvs_oc_profile_t *psvs_oc_get_profile();
-void psvs_oc_set_profile(psvs_oc_profile_t *oc);
+void psvs_oc_set_profile(psvs_oc_profile_t *oc, psvs_oc_transition_t *transition);
 bool psvs_oc_has_changed();
 void psvs_oc_set_changed(bool changed);
 
@@ -58,7 +81,20 @@ int psvs_oc_get_default_freq(psvs_oc_device_t device);
 // manual freq adjust
 void psvs_oc_reset_manual(psvs_oc_device_t device);
 void psvs_oc_change_manual(psvs_oc_device_t device, bool raise_freq);
+void psvs_oc_set_manual(psvs_oc_device_t device, int freq);
+void psvs_oc_set_manual_freqs(const int freq[PSVS_OC_DEVICE_MAX]);
+
+// governor
+int psvs_oc_get_governor_freq(psvs_oc_device_t device);
+void psvs_oc_set_governor_freq(psvs_oc_device_t device, int freq);
+int psvs_oc_get_target_fps();
+// thermal ceiling, 0 = none
+int psvs_oc_get_ceiling(psvs_oc_device_t device);
+void psvs_oc_set_ceilings(const int freq[PSVS_OC_DEVICE_MAX]);
+void psvs_oc_change_target_fps(bool raise_fps);
 
 void psvs_oc_init();
+void psvs_oc_setup();    // module_start, before psvs_oc_init()
+void psvs_oc_teardown(); // module_stop
 
 #endif
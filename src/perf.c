@@ -1,6 +1,7 @@
 #include <vitasdkkern.h>
 #include <taihen.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "main.h"
 
@@ -11,9 +12,12 @@ SceUInt32 ksceKernelSysrootGetCurrentAddressSpaceCB();
 
 #define PSVS_PERF_CPU_SAMPLERATE 500 * 1000
 #define PSVS_PERF_PEAK_SAMPLES 10
-static int g_perf_peak_usage_samples[PSVS_PERF_PEAK_SAMPLES] = {0};
-static int g_perf_peak_usage_rotation = 0;
-static int g_perf_usage[4] = {0, 0, 0, 0};
+static psvs_window_t g_perf_peak_usage;
+static psvs_loadavg_t g_perf_usage[4];
+static int g_perf_wakeups[4] = {0, 0, 0, 0};  // per second
+static int g_perf_switches[4] = {0, 0, 0, 0}; // per second
+static SceUInt32 g_perf_wakeups_last[4] = {0, 0, 0, 0};
+static SceUInt32 g_perf_switches_last[4] = {0, 0, 0, 0};
 
 static SceUInt32 g_perf_tick_last = 0; // AVG CPU load
 static SceUInt32 g_perf_tick_q_last = 0; // Peak CPU load
@@ -23,26 +27,295 @@ static SceKernelSysClock g_perf_idle_clock_last[4] = {0, 0, 0, 0};
 static SceKernelSysClock g_perf_idle_clock_q_last[4] = {0, 0, 0, 0};
 
 static psvs_memory_t g_perf_memusage = {0};
+static psvs_window_t g_perf_main_free;
+
+#define PSVS_PERF_BATT_TEMP_WINDOW 2 * 1000 * 1000
 static psvs_battery_t g_perf_batt = {0};
+static psvs_ewma_t g_perf_batt_temp; // in 1/100 C
+static SceUInt32 g_perf_tick_batt_last = 0;
+
+#define PSVS_PERF_FPS_SAMPLES 8
+static psvs_window_t g_perf_frametime_window;
+static int g_perf_fps = 0; // unique frames
+
+// Every SetFrameBuf call, incl. re-presents of the same fb
+#define PSVS_PERF_PRESENT_SAMPLERATE 500 * 1000
+#define PSVS_PERF_FB_INDEX_MAX 2
+#define PSVS_PERF_FB_STATIC_WINDOWS 4 // same fb this many windows, single buffered
+static SceUInt32 g_perf_tick_present_last = 0;
+static uint32_t g_perf_present_n = 0;
+static uint32_t g_perf_unique_n = 0;      // new fbs in current present window
+static int g_perf_static_windows = 0;     // present windows without a new fb
+static int g_perf_present_fps = 0;
+static const void *g_perf_fb_base_last[PSVS_PERF_FB_INDEX_MAX] = {NULL, NULL};
+
+static uint32_t g_perf_frametimes[PSVS_PERF_FRAMETIME_HISTORY];
+static uint32_t g_perf_frame_count = 0;
+
+// Frametime histogram of the frames in history
+static psvs_frametime_hist_t g_perf_hist = {0};
+
+// Stutter detection, frames are measured in vblanks
+#define PSVS_PERF_VBLANK_BUCKETS 16 // last one also holds anything longer
+#define PSVS_PERF_FRAME_HITCH 0x80  // flag in g_perf_frame_vblanks
+#define PSVS_PERF_STUTTER_BINS 60   // 1s each
+static uint8_t g_perf_frame_vblanks[PSVS_PERF_FRAMETIME_HISTORY];
+static uint16_t g_perf_vblank_hist[PSVS_PERF_VBLANK_BUCKETS] = {0};
+static int g_perf_vcount_last = 0;
+static bool g_perf_frame_gap = true; // frames were not seen, re-seed on next one
+
+typedef struct {
+    uint16_t hitches;
+    uint16_t missed;
+} psvs_perf_stutter_bin_t;
+
+static psvs_perf_stutter_bin_t g_perf_stutter_bins[PSVS_PERF_STUTTER_BINS] = {0};
+static int g_perf_stutter_bin = 0;
+static uint32_t g_perf_stutter_bin_time = 0; // us into current bin
+static uint32_t g_perf_hitches = 0;
+static SceUInt32 g_perf_last_hitch = 0;
+
+#define PSVS_WINDOW_SLOT(seq) ((seq) & (PSVS_WINDOW_MAX - 1))
+
+// exp(-period / window) in Q16.16, as (1 - x/256)^256
+// Squared in Q2.30, Q16.16 steps are too coarse for short periods
+#define PSVS_PERF_DECAY_SHIFT 30
+static uint32_t _psvs_perf_decay(uint32_t period, uint32_t window) {
+    uint64_t x = ((uint64_t)period << PSVS_PERF_DECAY_SHIFT) / window;
+    if (x >= (256ULL << PSVS_PERF_DECAY_SHIFT))
+        return 0;
+
+    uint64_t decay = (1ULL << PSVS_PERF_DECAY_SHIFT) - (x >> 8);
+    for (int i = 0; i < 8; i++)
+        decay = (decay * decay + (1ULL << (PSVS_PERF_DECAY_SHIFT - 1))) >> PSVS_PERF_DECAY_SHIFT;
+    return (decay + (1ULL << (PSVS_PERF_DECAY_SHIFT - PSVS_STAT_SHIFT - 1))) >> (PSVS_PERF_DECAY_SHIFT - PSVS_STAT_SHIFT);
+}
+
+// Time constant `window`, for samples every `period` (both in us)
+void psvs_perf_ewma_init(psvs_ewma_t *ewma, uint32_t period, uint32_t window) {
+    ewma->value = 0;
+    ewma->decay = _psvs_perf_decay(period, window);
+    ewma->primed = false;
+}
+
+// For samples at a varying rate, `period` is the time since the last one
+void psvs_perf_ewma_set_period(psvs_ewma_t *ewma, uint32_t period, uint32_t window) {
+    ewma->decay = _psvs_perf_decay(period, window);
+}
+
+void psvs_perf_ewma_add(psvs_ewma_t *ewma, int32_t sample) {
+    int32_t x = sample * PSVS_STAT_ONE;
+    if (!ewma->primed) {
+        ewma->value = x;
+        ewma->primed = true;
+        return;
+    }
+
+    ewma->value = x + (int32_t)(((int64_t)(ewma->value - x) * ewma->decay) >> PSVS_STAT_SHIFT);
+}
+
+int32_t psvs_perf_ewma_get(const psvs_ewma_t *ewma) {
+    return (ewma->value + (PSVS_STAT_ONE / 2)) >> PSVS_STAT_SHIFT;
+}
+
+void psvs_perf_window_init(psvs_window_t *window, int size) {
+    memset(window, 0, sizeof(psvs_window_t));
+    if (size < 1)
+        size = 1;
+    if (size > PSVS_WINDOW_MAX)
+        size = PSVS_WINDOW_MAX;
+    window->size = size;
+}
+
+void psvs_perf_window_add(psvs_window_t *window, int32_t sample) {
+    uint32_t seq = window->seq;
+
+    // Drop the sample leaving the window
+    if (window->n == window->size) {
+        uint32_t old = seq - window->size;
+        window->sum -= window->samples[PSVS_WINDOW_SLOT(old)];
+        if (window->min_n && window->min_q[PSVS_WINDOW_SLOT(window->min_head)] == old) {
+            window->min_head++;
+            window->min_n--;
+        }
+        if (window->max_n && window->max_q[PSVS_WINDOW_SLOT(window->max_head)] == old) {
+            window->max_head++;
+            window->max_n--;
+        }
+    } else {
+        window->n++;
+    }
+
+    window->samples[PSVS_WINDOW_SLOT(seq)] = sample;
+    window->sum += sample;
+
+    // Older samples that can't be min/max anymore leave the deques
+    while (window->min_n && window->samples[PSVS_WINDOW_SLOT(
+            window->min_q[PSVS_WINDOW_SLOT(window->min_head + window->min_n - 1)])] >= sample)
+        window->min_n--;
+    window->min_q[PSVS_WINDOW_SLOT(window->min_head + window->min_n)] = seq;
+    window->min_n++;
+
+    while (window->max_n && window->samples[PSVS_WINDOW_SLOT(
+            window->max_q[PSVS_WINDOW_SLOT(window->max_head + window->max_n - 1)])] <= sample)
+        window->max_n--;
+    window->max_q[PSVS_WINDOW_SLOT(window->max_head + window->max_n)] = seq;
+    window->max_n++;
+
+    window->seq = seq + 1;
+}
+
+int32_t psvs_perf_window_min(const psvs_window_t *window) {
+    if (!window->min_n)
+        return 0;
+    return window->samples[PSVS_WINDOW_SLOT(window->min_q[PSVS_WINDOW_SLOT(window->min_head)])];
+}
+
+int32_t psvs_perf_window_max(const psvs_window_t *window) {
+    if (!window->max_n)
+        return 0;
+    return window->samples[PSVS_WINDOW_SLOT(window->max_q[PSVS_WINDOW_SLOT(window->max_head)])];
+}
+
+int32_t psvs_perf_window_mean(const psvs_window_t *window) {
+    if (!window->n)
+        return 0;
+    return (window->sum + (window->n / 2)) / window->n;
+}
+
+// 1s/5s/15s averages, like the unix load average
+void psvs_perf_loadavg_init(psvs_loadavg_t *loadavg, uint32_t period) {
+    psvs_perf_ewma_init(&loadavg->avg[PSVS_LOADAVG_1S], period, 1 * SECOND);
+    psvs_perf_ewma_init(&loadavg->avg[PSVS_LOADAVG_5S], period, 5 * SECOND);
+    psvs_perf_ewma_init(&loadavg->avg[PSVS_LOADAVG_15S], period, 15 * SECOND);
+}
+
+void psvs_perf_loadavg_add(psvs_loadavg_t *loadavg, int32_t sample) {
+    for (int i = 0; i < PSVS_LOADAVG_MAX; i++)
+        psvs_perf_ewma_add(&loadavg->avg[i], sample);
+}
+
+int32_t psvs_perf_loadavg_get(const psvs_loadavg_t *loadavg, psvs_loadavg_window_t window) {
+    return psvs_perf_ewma_get(&loadavg->avg[window]);
+}
+
+static inline int _psvs_perf_hist_bucket(uint32_t frametime) {
+    frametime >>= PSVS_PERF_HIST_SHIFT;
+    return frametime < PSVS_PERF_HIST_BUCKETS ? frametime : PSVS_PERF_HIST_BUCKETS - 1;
+}
+
+static inline uint32_t _psvs_perf_hist_value(int bucket) {
+    if (bucket == PSVS_PERF_HIST_BUCKETS - 1)
+        return bucket << PSVS_PERF_HIST_SHIFT;
+    return (bucket << PSVS_PERF_HIST_SHIFT) + (1 << (PSVS_PERF_HIST_SHIFT - 1)); // middle
+}
+
+void psvs_perf_hist_add(psvs_frametime_hist_t *hist, uint32_t frametime) {
+    hist->n[_psvs_perf_hist_bucket(frametime)]++;
+}
+
+void psvs_perf_hist_remove(psvs_frametime_hist_t *hist, uint32_t frametime) {
+    hist->n[_psvs_perf_hist_bucket(frametime)]--;
+}
+
+void psvs_perf_hist_stats(const psvs_frametime_hist_t *hist, uint32_t frames, psvs_frametime_stats_t *stats) {
+    stats->frames = frames;
+    stats->p50 = stats->p99 = stats->p99_9 = 0;
+    stats->low_1 = 0;
+    if (frames == 0)
+        return;
+
+    // Ranks from the fastest frame, rounded up
+    uint32_t rank_50 = ((uint64_t)frames * 500 + 999) / 1000;
+    uint32_t rank_99 = ((uint64_t)frames * 990 + 999) / 1000;
+    uint32_t rank_99_9 = ((uint64_t)frames * 999 + 999) / 1000;
+
+    uint32_t n = 0;
+    for (int i = 0; i < PSVS_PERF_HIST_BUCKETS && n < rank_99_9; i++) {
+        n += hist->n[i];
+        if (!stats->p50 && n >= rank_50)
+            stats->p50 = _psvs_perf_hist_value(i);
+        if (!stats->p99 && n >= rank_99)
+            stats->p99 = _psvs_perf_hist_value(i);
+        if (n >= rank_99_9)
+            stats->p99_9 = _psvs_perf_hist_value(i);
+    }
 
-#define PSVS_PERF_FPS_SAMPLES 5
-static uint32_t g_perf_frametime_sum = 0;
-static uint8_t g_perf_frametime_n = 0;
-static int g_perf_fps = 0;
+    // Average of the slowest 1%
+    uint32_t low_n = (frames + 99) / 100;
+    uint64_t low_sum = 0;
+    n = 0;
+    for (int i = PSVS_PERF_HIST_BUCKETS - 1; i >= 0 && n < low_n; i--) {
+        uint32_t take = hist->n[i];
+        if (take > low_n - n)
+            take = low_n - n;
+        n += take;
+        low_sum += (uint64_t)take * _psvs_perf_hist_value(i);
+    }
+    if (n > 0 && low_sum > 0)
+        stats->low_1 = ((uint64_t)SECOND * n + (low_sum / 2)) / low_sum;
+}
 
 int psvs_perf_get_fps() {
     return g_perf_fps;
 }
 
+int psvs_perf_get_present_fps() {
+    return g_perf_present_fps;
+}
+
+uint32_t psvs_perf_get_frame_count() {
+    return __atomic_load_n(&g_perf_frame_count, __ATOMIC_ACQUIRE);
+}
+
+// Valid for the last PSVS_PERF_FRAMETIME_HISTORY frames only
+uint32_t psvs_perf_get_frametime(uint32_t frame) {
+    return g_perf_frametimes[frame & (PSVS_PERF_FRAMETIME_HISTORY - 1)];
+}
+
+bool psvs_perf_is_hitch(uint32_t frame) {
+    return g_perf_frame_vblanks[frame & (PSVS_PERF_FRAMETIME_HISTORY - 1)] & PSVS_PERF_FRAME_HITCH;
+}
+
+void psvs_perf_get_stutter(psvs_stutter_t *stutter) {
+    stutter->hitches_min = 0;
+    stutter->missed_min = 0;
+    for (int i = 0; i < PSVS_PERF_STUTTER_BINS; i++) {
+        stutter->hitches_min += g_perf_stutter_bins[i].hitches;
+        stutter->missed_min += g_perf_stutter_bins[i].missed;
+    }
+
+    stutter->hitches = g_perf_hitches;
+    stutter->last_hitch = g_perf_last_hitch;
+}
+
+// Walks the histogram, hook may update it meanwhile (off by a frame at most)
+void psvs_perf_get_frametime_stats(psvs_frametime_stats_t *stats) {
+    uint32_t frames = psvs_perf_get_frame_count();
+    if (frames > PSVS_PERF_FRAMETIME_HISTORY)
+        frames = PSVS_PERF_FRAMETIME_HISTORY;
+
+    psvs_perf_hist_stats(&g_perf_hist, frames, stats);
+}
+
 int psvs_perf_get_load(int core) {
-    return g_perf_usage[core];
+    return psvs_perf_loadavg_get(&g_perf_usage[core], PSVS_LOADAVG_1S);
+}
+
+int psvs_perf_get_load_avg(int core, psvs_loadavg_window_t window) {
+    return psvs_perf_loadavg_get(&g_perf_usage[core], window);
+}
+
+int psvs_perf_get_wakeups(int core) {
+    return g_perf_wakeups[core];
+}
+
+int psvs_perf_get_switches(int core) {
+    return g_perf_switches[core];
 }
 
 int psvs_perf_get_peak() {
-    int peak_total = 0;
-    for (int i = 0; i < PSVS_PERF_PEAK_SAMPLES; i++)
-        peak_total += g_perf_peak_usage_samples[i];
-    return peak_total / PSVS_PERF_PEAK_SAMPLES;
+    return psvs_perf_window_mean(&g_perf_peak_usage);
 }
 
 psvs_battery_t *psvs_perf_get_batt() {
@@ -53,21 +326,142 @@ psvs_memory_t *psvs_perf_get_memusage() {
     return &g_perf_memusage;
 }
 
-void psvs_perf_calc_fps() {
+static int _psvs_perf_vblank_median(uint32_t frames) {
+    uint32_t rank = (frames + 1) / 2;
+    uint32_t n = 0;
+    for (int i = 0; i < PSVS_PERF_VBLANK_BUCKETS; i++) {
+        n += g_perf_vblank_hist[i];
+        if (n >= rank)
+            return i;
+    }
+    return PSVS_PERF_VBLANK_BUCKETS - 1;
+}
+
+// Classifies frame against the median frame length, in vblanks
+static uint8_t _psvs_perf_detect_stutter(SceUInt32 tick_now, uint32_t frametime) {
+    int vcount = ksceDisplayGetVcount();
+    int vblanks = vcount - g_perf_vcount_last;
+    g_perf_vcount_last = vcount;
+    if (vblanks < 0 || vblanks >= PSVS_PERF_VBLANK_BUCKETS)
+        vblanks = PSVS_PERF_VBLANK_BUCKETS - 1;
+
+    // Advance per-second bins, clearing the ones skipped
+    uint32_t elapsed = g_perf_stutter_bin_time + frametime;
+    uint32_t advance = elapsed / SECOND;
+    g_perf_stutter_bin_time = elapsed % SECOND;
+    if (advance > PSVS_PERF_STUTTER_BINS)
+        advance = PSVS_PERF_STUTTER_BINS;
+    for (uint32_t i = 0; i < advance; i++) {
+        g_perf_stutter_bin = (g_perf_stutter_bin + 1) % PSVS_PERF_STUTTER_BINS;
+        g_perf_stutter_bins[g_perf_stutter_bin].hitches = 0;
+        g_perf_stutter_bins[g_perf_stutter_bin].missed = 0;
+    }
+
+    uint32_t frames = g_perf_frame_count < PSVS_PERF_FRAMETIME_HISTORY ? g_perf_frame_count : PSVS_PERF_FRAMETIME_HISTORY;
+    int median = frames ? _psvs_perf_vblank_median(frames) : 0;
+    uint8_t flags = vblanks;
+
+    if (median > 0 && vblanks > median) {
+        psvs_perf_stutter_bin_t *bin = &g_perf_stutter_bins[g_perf_stutter_bin];
+        bin->missed += vblanks - median;
+
+        // Hitch if over 1.5x the median
+        if (vblanks * 2 > median * 3) {
+            bin->hitches++;
+            g_perf_hitches++;
+            g_perf_last_hitch = tick_now ? tick_now : 1;
+            flags |= PSVS_PERF_FRAME_HITCH;
+        }
+    }
+
+    return flags;
+}
+
+void psvs_perf_init() {
+    for (int i = 0; i < 4; i++)
+        psvs_perf_loadavg_init(&g_perf_usage[i], PSVS_PERF_CPU_SAMPLERATE);
+    psvs_perf_window_init(&g_perf_peak_usage, PSVS_PERF_PEAK_SAMPLES);
+    psvs_perf_window_init(&g_perf_frametime_window, PSVS_PERF_FPS_SAMPLES);
+    psvs_perf_window_init(&g_perf_main_free, PSVS_WINDOW_MAX);
+    psvs_perf_ewma_init(&g_perf_batt_temp, 0, PSVS_PERF_BATT_TEMP_WINDOW);
+}
+
+// Display hook skipped frames, last tick and vcount are stale
+void psvs_perf_frame_gap() {
+    g_perf_frame_gap = true;
+}
+
+void psvs_perf_calc_fps(int index, const void *base) {
     SceUInt32 tick_now = ksceKernelGetProcessTimeLowCore();
+    if (index < 0 || index >= PSVS_PERF_FB_INDEX_MAX)
+        index = 0;
+
+    // First frame after a gap only seeds the deltas, it would count as a hitch
+    if (g_perf_frame_gap) {
+        g_perf_frame_gap = false;
+        g_perf_tick_fps_last = tick_now;
+        g_perf_vcount_last = ksceDisplayGetVcount();
+        g_perf_tick_present_last = tick_now;
+        g_perf_present_n = 0;
+        g_perf_unique_n = 0;
+        g_perf_static_windows = 0;
+        g_perf_fb_base_last[index] = base;
+        return;
+    }
+
+    // Re-present of the same fb is not a new frame
+    bool unique = g_perf_fb_base_last[index] != base;
+    g_perf_fb_base_last[index] = base;
+
+    // Count every present, update rate periodically
+    g_perf_present_n++;
+    g_perf_unique_n += unique;
+    uint32_t present_diff = tick_now - g_perf_tick_present_last;
+    if (present_diff >= PSVS_PERF_PRESENT_SAMPLERATE) {
+        g_perf_present_fps = (g_perf_present_n * SECOND + (present_diff / 2)) / present_diff;
+
+        // No new fb for a whole window: stalled, or single buffered if it lasts
+        if (g_perf_unique_n == 0) {
+            if (g_perf_static_windows < PSVS_PERF_FB_STATIC_WINDOWS)
+                g_perf_static_windows++;
+            g_perf_fps = g_perf_static_windows < PSVS_PERF_FB_STATIC_WINDOWS ? 0 : g_perf_present_fps;
+        } else {
+            g_perf_static_windows = 0;
+        }
+
+        g_perf_present_n = 0;
+        g_perf_unique_n = 0;
+        g_perf_tick_present_last = tick_now;
+    }
+
+    if (!unique)
+        return;
+
     uint32_t frametime = tick_now - g_perf_tick_fps_last;
+    g_perf_tick_fps_last = tick_now;
 
-    // Update FPS when enough samples are collected
-    if (g_perf_frametime_n > PSVS_PERF_FPS_SAMPLES) {
-        uint32_t frametime_avg = g_perf_frametime_sum / g_perf_frametime_n;
+    // FPS from the mean of the last few frametimes
+    psvs_perf_window_add(&g_perf_frametime_window, frametime < INT32_MAX ? frametime : INT32_MAX);
+    int32_t frametime_avg = psvs_perf_window_mean(&g_perf_frametime_window);
+    if (frametime_avg > 0)
         g_perf_fps = (SECOND + (frametime_avg / 2) + 1) / frametime_avg;
-        g_perf_frametime_n = 0;
-        g_perf_frametime_sum = 0;
+
+    uint8_t vblanks = _psvs_perf_detect_stutter(tick_now, frametime);
+
+    // Move the frame leaving history out of histograms
+    int hist_index = g_perf_frame_count & (PSVS_PERF_FRAMETIME_HISTORY - 1);
+    uint32_t *slot = &g_perf_frametimes[hist_index];
+    if (g_perf_frame_count >= PSVS_PERF_FRAMETIME_HISTORY) {
+        psvs_perf_hist_remove(&g_perf_hist, *slot);
+        g_perf_vblank_hist[g_perf_frame_vblanks[hist_index] & ~PSVS_PERF_FRAME_HITCH]--;
     }
+    psvs_perf_hist_add(&g_perf_hist, frametime);
+    g_perf_vblank_hist[vblanks & ~PSVS_PERF_FRAME_HITCH]++;
+    g_perf_frame_vblanks[hist_index] = vblanks;
 
-    g_perf_frametime_n++;
-    g_perf_frametime_sum += frametime;
-    g_perf_tick_fps_last = tick_now;
+    // Publish frametime after it is stored
+    *slot = frametime;
+    __atomic_store_n(&g_perf_frame_count, g_perf_frame_count + 1, __ATOMIC_RELEASE);
 }
 
 void psvs_perf_poll_cpu() {
@@ -82,12 +476,23 @@ void psvs_perf_poll_cpu() {
     // Calculate AVG CPU usage
     if (tick_diff >= PSVS_PERF_CPU_SAMPLERATE) {
         for (int i = 0; i < 4; i++) {
-            g_perf_usage[i] = (int)(100.0f - ((info.cpuInfo[i].idleClock - g_perf_idle_clock_last[i]) / (float)tick_diff) * 100);
-            if (g_perf_usage[i] < 0)
-                g_perf_usage[i] = 0;
-            if (g_perf_usage[i] > 100)
-                g_perf_usage[i] = 100;
+            uint64_t idle = info.cpuInfo[i].idleClock - g_perf_idle_clock_last[i];
+            int usage = 100 - (int)((idle * 100 + (tick_diff / 2)) / tick_diff);
+            if (usage < 0)
+                usage = 0;
+            if (g_perf_tick_last != 0) // first delta is since boot
+                psvs_perf_loadavg_add(&g_perf_usage[i], usage);
             g_perf_idle_clock_last[i] = info.cpuInfo[i].idleClock;
+
+            // Wakeups and context switches per second
+            if (g_perf_tick_last != 0) { // first counts are since boot
+                SceUInt32 wakeups = info.cpuInfo[i].comesOutOfIdleCount - g_perf_wakeups_last[i];
+                SceUInt32 switches = info.cpuInfo[i].threadSwitchCount - g_perf_switches_last[i];
+                g_perf_wakeups[i] = ((uint64_t)wakeups * SECOND + (tick_diff / 2)) / tick_diff;
+                g_perf_switches[i] = ((uint64_t)switches * SECOND + (tick_diff / 2)) / tick_diff;
+            }
+            g_perf_wakeups_last[i] = info.cpuInfo[i].comesOutOfIdleCount;
+            g_perf_switches_last[i] = info.cpuInfo[i].threadSwitchCount;
         }
 
         g_perf_tick_last = tick_now;
@@ -95,20 +500,17 @@ void psvs_perf_poll_cpu() {
 
     // Calculate peak ST CPU usage
     int max_usage = 0;
-    for (int i = 0; i < 4; i++) {
-        int usage = (int)(100.0f - ((info.cpuInfo[i].idleClock - g_perf_idle_clock_q_last[i]) / (float)tick_q_diff) * 100);
-        if (usage > max_usage)
-            max_usage = usage;
-        g_perf_idle_clock_q_last[i] = info.cpuInfo[i].idleClock;
+    if (tick_q_diff > 0) {
+        for (int i = 0; i < 4; i++) {
+            uint64_t idle = info.cpuInfo[i].idleClock - g_perf_idle_clock_q_last[i];
+            int usage = 100 - (int)((idle * 100 + (tick_q_diff / 2)) / tick_q_diff);
+            if (usage > max_usage)
+                max_usage = usage;
+        }
     }
-    if (max_usage < 0)
-        max_usage = 0;
-    if (max_usage > 100)
-        max_usage = 100;
-    g_perf_peak_usage_samples[g_perf_peak_usage_rotation] = max_usage;
-    g_perf_peak_usage_rotation++;
-    if (g_perf_peak_usage_rotation >= PSVS_PERF_PEAK_SAMPLES)
-        g_perf_peak_usage_rotation = 0; // flip
+    for (int i = 0; i < 4; i++)
+        g_perf_idle_clock_q_last[i] = info.cpuInfo[i].idleClock;
+    psvs_perf_window_add(&g_perf_peak_usage, max_usage);
     g_perf_tick_q_last = tick_now;
 }
 
@@ -119,29 +521,31 @@ void psvs_perf_poll_memory() {
 
     if (*(uint32_t *)(sysroot_cas + 328) > 0) {
         SceSysmemForKernel_0x3650963F(*(uint32_t *)(sysroot_cas + 328), &info);
-        PSVS_CHECK_ASSIGN(g_perf_memusage, main_free, info.free);
-        PSVS_CHECK_ASSIGN(g_perf_memusage, main_total, info.total);
+        g_perf_memusage.main_free = info.free;
+        g_perf_memusage.main_total = info.total;
     } else {
-        PSVS_CHECK_ASSIGN(g_perf_memusage, main_free, 0);
-        PSVS_CHECK_ASSIGN(g_perf_memusage, main_total, 0);
+        g_perf_memusage.main_free = 0;
+        g_perf_memusage.main_total = 0;
     }
+    psvs_perf_window_add(&g_perf_main_free, g_perf_memusage.main_free);
+    g_perf_memusage.main_free_min = psvs_perf_window_min(&g_perf_main_free);
 
     if (*(uint32_t *)(sysroot_cas + 332) > 0) {
         SceSysmemForKernel_0x3650963F(*(uint32_t *)(sysroot_cas + 332), &info);
-        PSVS_CHECK_ASSIGN(g_perf_memusage, cdram_free, info.free);
-        PSVS_CHECK_ASSIGN(g_perf_memusage, cdram_total, info.total);
+        g_perf_memusage.cdram_free = info.free;
+        g_perf_memusage.cdram_total = info.total;
     } else {
-        PSVS_CHECK_ASSIGN(g_perf_memusage, cdram_free, 0);
-        PSVS_CHECK_ASSIGN(g_perf_memusage, cdram_total, 0);
+        g_perf_memusage.cdram_free = 0;
+        g_perf_memusage.cdram_total = 0;
     }
 
     if (*(uint32_t *)(sysroot_cas + 316) > 0) {
         SceSysmemForKernel_0x3650963F(*(uint32_t *)(sysroot_cas + 316), &info);
-        PSVS_CHECK_ASSIGN(g_perf_memusage, phycont_free, info.free);
-        PSVS_CHECK_ASSIGN(g_perf_memusage, phycont_total, info.total);
+        g_perf_memusage.phycont_free = info.free;
+        g_perf_memusage.phycont_total = info.total;
     } else {
-        PSVS_CHECK_ASSIGN(g_perf_memusage, phycont_free, 0);
-        PSVS_CHECK_ASSIGN(g_perf_memusage, phycont_total, 0);
+        g_perf_memusage.phycont_free = 0;
+        g_perf_memusage.phycont_total = 0;
     }
 }
 
@@ -154,23 +558,28 @@ void psvs_perf_poll_batt() {
     // Grab batt percentage
     val = kscePowerGetBatteryLifePercent();
     if (val >= 0 && val <= 100) {
-        PSVS_CHECK_ASSIGN(g_perf_batt, percent, val);
+        g_perf_batt.percent = val;
     }
 
-    // Grab batt/case temp
-    val = kscePowerGetBatteryTemp() / 100;
-    if (val >= 0 && val <= 99) {
-        PSVS_CHECK_ASSIGN(g_perf_batt, temp, val);
+    // Grab batt/case temp, smoothed over the actual poll interval
+    // (psvs_thread tick varies and polling stops while hidden)
+    val = kscePowerGetBatteryTemp();
+    if (val >= 0 && val <= 9999) {
+        SceUInt32 tick_now = ksceKernelGetProcessTimeLowCore();
+        psvs_perf_ewma_set_period(&g_perf_batt_temp, tick_now - g_perf_tick_batt_last, PSVS_PERF_BATT_TEMP_WINDOW);
+        g_perf_tick_batt_last = tick_now;
+        psvs_perf_ewma_add(&g_perf_batt_temp, val);
+        g_perf_batt.temp = psvs_perf_ewma_get(&g_perf_batt_temp) / 100;
     }
 
     // Grab batt life time
     val = kscePowerGetBatteryLifeTime();
     if (val >= 0 && val < 100 * 60) {
-        PSVS_CHECK_ASSIGN(g_perf_batt, lt_hours, val / 60);
-        PSVS_CHECK_ASSIGN(g_perf_batt, lt_minutes, val - (g_perf_batt.lt_hours * 60));
+        g_perf_batt.lt_hours = val / 60;
+        g_perf_batt.lt_minutes = val - (g_perf_batt.lt_hours * 60);
     }
 
     // Grab charger
     bool bval = kscePowerIsBatteryCharging();
-    PSVS_CHECK_ASSIGN(g_perf_batt, is_charging, bval);
+    g_perf_batt.is_charging = bval;
 }
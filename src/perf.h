@@ -1,10 +1,6 @@
 #ifndef _PERF_H_
 #define _PERF_H_
 
-#define PSVS_CHECK_ASSIGN(struct, field, new_value) \
-    if (struct.field != (new_value)) struct._has_changed = true; \
-    struct.field = (new_value)
-
 typedef struct SceKernelSystemInfo {
     SceSize   size;
     SceUInt32 activeCpuMask;
@@ -22,6 +18,42 @@ typedef struct SceSysmemAddressSpaceInfo {
     uint32_t unkC;
 } SceSysmemAddressSpaceInfo;
 
+// Streaming stats, Q16.16 fixed-point, O(1) per sample
+#define PSVS_STAT_SHIFT 16
+#define PSVS_STAT_ONE (1 << PSVS_STAT_SHIFT)
+
+// EWMA samples must fit in 15 bits
+typedef struct psvs_ewma_t {
+    int32_t value;  // Q16.16
+    uint32_t decay; // weight of the old value, Q16.16
+    bool primed;    // first sample is taken as is
+} psvs_ewma_t;
+
+// Sliding window of the last `size` samples, must be power of 2 capacity
+#define PSVS_WINDOW_MAX 32
+
+typedef struct psvs_window_t {
+    int32_t samples[PSVS_WINDOW_MAX];
+    uint32_t min_q[PSVS_WINDOW_MAX]; // monotonic deques of sample seqs
+    uint32_t max_q[PSVS_WINDOW_MAX];
+    uint8_t min_head, min_n;
+    uint8_t max_head, max_n;
+    uint8_t size, n;
+    uint32_t seq;                    // samples added so far
+    int64_t sum;
+} psvs_window_t;
+
+typedef enum {
+    PSVS_LOADAVG_1S,
+    PSVS_LOADAVG_5S,
+    PSVS_LOADAVG_15S,
+    PSVS_LOADAVG_MAX
+} psvs_loadavg_window_t;
+
+typedef struct psvs_loadavg_t {
+    psvs_ewma_t avg[PSVS_LOADAVG_MAX];
+} psvs_loadavg_t;
+
 typedef struct psvs_memory_t {
     uint32_t main_free;
     uint32_t main_total;
@@ -29,7 +61,7 @@ typedef struct psvs_memory_t {
     uint32_t cdram_total;
     uint32_t phycont_free;
     uint32_t phycont_total;
-    bool _has_changed;
+    uint32_t main_free_min; // low-water mark over the last PSVS_WINDOW_MAX polls
 } psvs_memory_t;
 
 typedef struct psvs_battery_t {
@@ -38,17 +70,70 @@ typedef struct psvs_battery_t {
     int lt_hours;
     int lt_minutes;
     bool is_charging;
-    bool _has_changed;
 } psvs_battery_t;
 
-void psvs_perf_calc_fps();
+// Per-frame frametime history, must be power of 2
+#define PSVS_PERF_FRAMETIME_HISTORY 1024
+
+typedef struct psvs_frametime_stats_t {
+    uint32_t frames; // in window
+    uint32_t p50;    // frametime percentiles, in us
+    uint32_t p99;
+    uint32_t p99_9;
+    int low_1;       // 1% low FPS (avg of slowest 1% frames)
+} psvs_frametime_stats_t;
+
+// Frametime histogram, 256us buckets
+#define PSVS_PERF_HIST_SHIFT 8
+#define PSVS_PERF_HIST_BUCKETS 256 // last one also holds anything slower
+
+typedef struct psvs_frametime_hist_t {
+    uint32_t n[PSVS_PERF_HIST_BUCKETS];
+} psvs_frametime_hist_t;
+
+typedef struct psvs_stutter_t {
+    int hitches_min;      // hitches in the last minute
+    int missed_min;       // missed vblanks in the last minute
+    uint32_t hitches;     // since start
+    SceUInt32 last_hitch; // process time of last hitch, 0 if none
+} psvs_stutter_t;
+
+void psvs_perf_hist_add(psvs_frametime_hist_t *hist, uint32_t frametime);
+void psvs_perf_hist_remove(psvs_frametime_hist_t *hist, uint32_t frametime);
+void psvs_perf_hist_stats(const psvs_frametime_hist_t *hist, uint32_t frames, psvs_frametime_stats_t *stats);
+
+void psvs_perf_ewma_init(psvs_ewma_t *ewma, uint32_t period, uint32_t window);
+void psvs_perf_ewma_set_period(psvs_ewma_t *ewma, uint32_t period, uint32_t window);
+void psvs_perf_ewma_add(psvs_ewma_t *ewma, int32_t sample);
+int32_t psvs_perf_ewma_get(const psvs_ewma_t *ewma);
+void psvs_perf_window_init(psvs_window_t *window, int size);
+void psvs_perf_window_add(psvs_window_t *window, int32_t sample);
+int32_t psvs_perf_window_min(const psvs_window_t *window);
+int32_t psvs_perf_window_max(const psvs_window_t *window);
+int32_t psvs_perf_window_mean(const psvs_window_t *window);
+void psvs_perf_loadavg_init(psvs_loadavg_t *loadavg, uint32_t period);
+void psvs_perf_loadavg_add(psvs_loadavg_t *loadavg, int32_t sample);
+int32_t psvs_perf_loadavg_get(const psvs_loadavg_t *loadavg, psvs_loadavg_window_t window);
+
+void psvs_perf_init();
+void psvs_perf_frame_gap();
+void psvs_perf_calc_fps(int index, const void *base);
 void psvs_perf_poll_cpu();
 void psvs_perf_poll_memory();
 void psvs_perf_poll_batt();
 
 int psvs_perf_get_fps();
+int psvs_perf_get_present_fps();
+uint32_t psvs_perf_get_frame_count();
+uint32_t psvs_perf_get_frametime(uint32_t frame);
+void psvs_perf_get_frametime_stats(psvs_frametime_stats_t *stats);
+bool psvs_perf_is_hitch(uint32_t frame);
+void psvs_perf_get_stutter(psvs_stutter_t *stutter);
 int psvs_perf_get_load(int core);
+int psvs_perf_get_load_avg(int core, psvs_loadavg_window_t window);
 int psvs_perf_get_peak();
+int psvs_perf_get_wakeups(int core);
+int psvs_perf_get_switches(int core);
 psvs_battery_t *psvs_perf_get_batt();
 psvs_memory_t *psvs_perf_get_memusage();
 
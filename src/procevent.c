@@ -0,0 +1,252 @@
+#include <vitasdkkern.h>
+#include <taihen.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "oc.h"
+#include "profile.h"
+#include "procevent.h"
+
+SceUInt32 ksceKernelGetProcessTimeLowCore();
+
+// Multi-producer (procevent hook may run on any thread), single consumer (worker)
+#define PSVS_PROCEVENT_EVF_QUEUED 1
+static psvs_procevent_t g_procevent_queue[PSVS_PROCEVENT_QUEUE_N];
+static uint32_t g_procevent_head = 0;    // hook side
+static uint32_t g_procevent_tail = 0;    // worker side
+static uint32_t g_procevent_done = 0;    // worker side, events fully handled
+static uint32_t g_procevent_dropped = 0; // hook side
+static uint32_t g_procevent_hook_max = 0; // us, slowest hook so far
+
+static SceUID g_procevent_evf_uid = -1;
+static SceUID g_procevent_thread_uid = -1;
+static bool g_procevent_thread_run = true;
+
+// Called from procevent hook, no locks or I/O
+void psvs_procevent_push(SceUID pid, int ev) {
+    SceUInt32 tick = ksceKernelGetProcessTimeLowCore();
+    psvs_procevent_t *slot;
+
+    uint32_t pos = __atomic_load_n(&g_procevent_head, __ATOMIC_RELAXED);
+    while (true) {
+        slot = &g_procevent_queue[pos & (PSVS_PROCEVENT_QUEUE_N - 1)];
+        int32_t diff = (int32_t)(__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&g_procevent_head, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break; // slot is ours
+        } else if (diff < 0) {
+            __atomic_add_fetch(&g_procevent_dropped, 1, __ATOMIC_RELAXED); // worker is behind
+            return;
+        } else {
+            pos = __atomic_load_n(&g_procevent_head, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->pid = pid;
+    slot->ev = ev;
+    slot->tick = tick;
+    __atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+
+    ksceKernelSetEventFlag(g_procevent_evf_uid, PSVS_PROCEVENT_EVF_QUEUED);
+
+    uint32_t took = ksceKernelGetProcessTimeLowCore() - tick;
+    uint32_t max = __atomic_load_n(&g_procevent_hook_max, __ATOMIC_RELAXED);
+    while (took > max && !__atomic_compare_exchange_n(&g_procevent_hook_max, &max, took, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+// Display hook checks this, g_app/g_titleid are stale until the worker is done
+bool psvs_procevent_is_pending() {
+    return __atomic_load_n(&g_procevent_head, __ATOMIC_ACQUIRE) != __atomic_load_n(&g_procevent_done, __ATOMIC_ACQUIRE);
+}
+
+static bool _psvs_procevent_pop(psvs_procevent_t *event) {
+    psvs_procevent_t *slot = &g_procevent_queue[g_procevent_tail & (PSVS_PROCEVENT_QUEUE_N - 1)];
+    if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != g_procevent_tail + 1)
+        return false; // empty, or producer still filling it
+
+    memcpy(event, slot, sizeof(psvs_procevent_t));
+    __atomic_store_n(&slot->seq, g_procevent_tail + PSVS_PROCEVENT_QUEUE_N, __ATOMIC_RELEASE);
+    g_procevent_tail++;
+    return true;
+}
+
+static psvs_app_t _psvs_procevent_get_app_type(int pid, const char *titleid) {
+    psvs_app_t app = PSVS_APP_MAX;
+
+    if (ksceSblACMgrIsPspEmu(pid)) {
+        app = PSVS_APP_BLACKLIST;
+    } else if (!strncmp(titleid, "NPXS", 4)) {
+        app = PSVS_APP_SYSTEM;
+
+        // TODO: Figure out a way to do this on the fly
+
+        if (!strncmp(&titleid[4], "10079", 5) ||     // Daily Checker BG
+                !strncmp(&titleid[4], "10063", 5)) { // MsgMW
+            app = PSVS_APP_MAX; // not an app
+        } else if (!strncmp(&titleid[4], "10007", 5) || // Welcome Park
+                   !strncmp(&titleid[4], "10010", 5) || // Videos
+                   !strncmp(&titleid[4], "10026", 5) || // Content Manager
+                   !strncmp(&titleid[4], "10095", 5)) { // Panoramic Camera
+            app = PSVS_APP_SYSTEM_XCL; // exclusive
+        }
+    } else if (ksceSblACMgrIsSceShell(pid) && !strncmp(titleid, "main", 4)) {
+        app = PSVS_APP_SCESHELL;
+    } else {
+        app = PSVS_APP_GAME;
+    }
+
+    return app;
+}
+
+// Timing log is for debug builds, cmake -DPSVS_DEBUG_LOG=ON
+#ifdef PSVS_DEBUG_LOG
+static const char *g_procevent_names[] = {"", "startup", "", "exit", "suspend", "resume"};
+
+// Launch latency taken off the hook: queued is how long the event waited,
+// apply is what the hook used to spend on profile lookup and clocks
+static void _psvs_procevent_log(const psvs_procevent_t *event, uint32_t queued, uint32_t apply,
+                                const psvs_oc_transition_t *transition) {
+    SceUID fd = psvs_log_open(PSVS_PROCEVENT_LOG, PSVS_PROCEVENT_LOG ".old");
+    if (fd < 0)
+        return;
+
+    SceDateTime time;
+    ksceRtcGetCurrentClockLocalTime(&time);
+
+    char buf[256];
+    int len = snprintf(buf, sizeof(buf), "%04d-%02d-%02d %02d:%02d:%02d %-9s %-7s queued=%uus apply=%uus hook_max=%uus dropped=%u",
+                       time.year, time.month, time.day, time.hour, time.minute, time.second,
+                       g_titleid, g_procevent_names[event->ev], queued, apply,
+                       __atomic_load_n(&g_procevent_hook_max, __ATOMIC_RELAXED),
+                       __atomic_load_n(&g_procevent_dropped, __ATOMIC_RELAXED));
+
+    // Clock changes it took, skipped ones cost nothing
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX && len < sizeof(buf); i++) {
+        if (transition->time[i])
+            len += snprintf(&buf[len], sizeof(buf) - len, " %s %d>%d %uus", psvs_oc_get_name(i),
+                            transition->from[i], transition->to[i], transition->time[i]);
+    }
+    if (len < sizeof(buf))
+        len += snprintf(&buf[len], sizeof(buf) - len, "\n");
+    if (len > sizeof(buf) - 1)
+        len = sizeof(buf) - 1;
+
+    ksceIoWrite(fd, buf, len);
+    ksceIoClose(fd);
+}
+#else
+static void _psvs_procevent_log(const psvs_procevent_t *event, uint32_t queued, uint32_t apply,
+                                const psvs_oc_transition_t *transition) {}
+#endif
+
+// Returns true if profile was applied, clock changes go to transition
+static bool _psvs_procevent_handle(const psvs_procevent_t *event, psvs_oc_transition_t *transition) {
+    char titleid[sizeof(g_titleid)];
+    psvs_app_t app = PSVS_APP_SCESHELL;
+
+    switch (event->ev) {
+        case PSVS_PROCEVENT_STARTUP:
+        case PSVS_PROCEVENT_RESUME:
+            // Ignore startup events if non-SceShell app is running
+            if (g_app != PSVS_APP_SCESHELL)
+                return false;
+
+            // Check titleid, process may be gone already
+            if (ksceKernelGetProcessTitleId(event->pid, titleid, sizeof(titleid)) < 0)
+                return false;
+
+            // Check app type
+            app = _psvs_procevent_get_app_type(event->pid, titleid);
+            if (app == PSVS_APP_MAX) // not an app
+                return false;
+
+            break;
+
+        case PSVS_PROCEVENT_EXIT:
+        case PSVS_PROCEVENT_SUSPEND:
+            if (g_pid != event->pid)
+                return false;
+
+            app = PSVS_APP_SCESHELL;
+            snprintf(titleid, sizeof(titleid), "main");
+            break;
+
+        default:
+            return false;
+    }
+
+    if (!strncmp(g_titleid, titleid, sizeof(g_titleid)))
+        return false;
+
+    // Set titleid
+    strncpy(g_titleid, titleid, sizeof(g_titleid));
+
+    // Set pid
+    g_pid = (event->ev == PSVS_PROCEVENT_STARTUP || event->ev == PSVS_PROCEVENT_RESUME) ? event->pid : INVALID_PID;
+
+    // Set type
+    g_app = app;
+
+    // Load profile
+    if (g_app == PSVS_APP_BLACKLIST || !psvs_profile_load(transition)) {
+        // If no profile exists or in blacklisted app,
+        // reset all options to default
+        psvs_oc_init();
+    }
+
+    return true;
+}
+
+static int psvs_procevent_thread(SceSize args, void *argp) {
+    psvs_procevent_t event;
+    psvs_oc_transition_t transition;
+
+    while (g_procevent_thread_run) {
+        ksceKernelWaitEventFlag(g_procevent_evf_uid, PSVS_PROCEVENT_EVF_QUEUED,
+                                SCE_KERNEL_EVF_WAITMODE_OR | SCE_KERNEL_EVF_WAITMODE_CLEAR_ALL, NULL, NULL);
+
+        // Events are handled in order, e.g. exit of one app before startup of next
+        while (_psvs_procevent_pop(&event)) {
+            SceUInt32 tick_start = ksceKernelGetProcessTimeLowCore();
+            memset(&transition, 0, sizeof(psvs_oc_transition_t));
+            if (_psvs_procevent_handle(&event, &transition)) {
+                SceUInt32 tick_end = ksceKernelGetProcessTimeLowCore();
+                _psvs_procevent_log(&event, tick_start - event.tick, tick_end - tick_start, &transition);
+            }
+            __atomic_store_n(&g_procevent_done, g_procevent_tail, __ATOMIC_RELEASE);
+        }
+    }
+
+    return 0;
+}
+
+int psvs_procevent_init() {
+    for (int i = 0; i < PSVS_PROCEVENT_QUEUE_N; i++)
+        g_procevent_queue[i].seq = i;
+
+    g_procevent_evf_uid = ksceKernelCreateEventFlag("psvs_procevent_evf", 0, 0, NULL);
+    if (g_procevent_evf_uid < 0)
+        return g_procevent_evf_uid;
+
+    // Same priority as psvs_thread, clocks should follow the app quickly
+    g_procevent_thread_uid = ksceKernelCreateThread("psvs_procevent_thread", psvs_procevent_thread, 0x3C, 0x2000, 0, 0x10000, 0);
+    if (g_procevent_thread_uid < 0)
+        return g_procevent_thread_uid;
+
+    ksceKernelStartThread(g_procevent_thread_uid, 0, NULL);
+    return 0;
+}
+
+void psvs_procevent_deinit() {
+    if (g_procevent_thread_uid >= 0) {
+        g_procevent_thread_run = false;
+        ksceKernelSetEventFlag(g_procevent_evf_uid, PSVS_PROCEVENT_EVF_QUEUED);
+        ksceKernelWaitThreadEnd(g_procevent_thread_uid, NULL, NULL);
+        ksceKernelDeleteThread(g_procevent_thread_uid);
+    }
+
+    if (g_procevent_evf_uid >= 0)
+        ksceKernelDeleteEventFlag(g_procevent_evf_uid);
+}
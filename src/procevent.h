@@ -0,0 +1,29 @@
+#ifndef _PROCEVENT_H_
+#define _PROCEVENT_H_
+
+#define PSVS_PROCEVENT_LOG "ur0:data/PSVshell_fork/procevent.log"
+
+#define PSVS_PROCEVENT_QUEUE_N 16 // must be power of 2
+
+typedef enum {
+    PSVS_PROCEVENT_STARTUP = 1,
+    PSVS_PROCEVENT_EXIT = 3,
+    PSVS_PROCEVENT_SUSPEND = 4,
+    PSVS_PROCEVENT_RESUME = 5
+} psvs_procevent_type_t;
+
+// Queued by the procevent hook, one slot of the lock-free queue
+typedef struct {
+    uint32_t seq;   // slot sequence, owned by the queue
+    SceUID pid;
+    int ev;
+    SceUInt32 tick; // hook entry, us
+} psvs_procevent_t;
+
+void psvs_procevent_push(SceUID pid, int ev);
+bool psvs_procevent_is_pending();
+
+int psvs_procevent_init();
+void psvs_procevent_deinit();
+
+#endif
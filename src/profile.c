@@ -3,12 +3,13 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <stddef.h>
 
 #include "main.h"
 #include "oc.h"
+#include "profile.h"
 
-#define PSVS_PROFILES_DIR "ur0:data/PSVshell_fork/profiles/"
-#define PSVS_COMPAT_PROFILES_DIR "ur0:data/PSVshell/profiles/"
+SceUInt32 ksceKernelGetProcessTimeLowCore();
 
 typedef struct {
     char ver[8];
@@ -16,40 +17,187 @@ typedef struct {
     int manual_freq[PSVS_OC_DEVICE_VENEZIA];
 } psvs_oc_compat_profile_t;
 
-static bool g_profile_exists = false;
-static bool g_profile_exists_global = false;
+typedef enum {
+    PSVS_PROFILE_DB_OK,
+    PSVS_PROFILE_DB_MISSING,
+    PSVS_PROFILE_DB_BAD // unknown format, never written over
+} psvs_profile_db_state_t;
+
+static psvs_profile_entry_t g_profile_db[PSVS_PROFILE_DB_MAX];
+static int g_profile_db_n = 0;
+static int16_t g_profile_db_index[PSVS_PROFILE_DB_SLOTS]; // entry or -1, open addressing
+static SceUID g_profile_mutex_uid = -1; // procevent hook reads, psvs_thread writes
+
+// Db file is written by a low priority worker, changes in between coalesce
+#define PSVS_PROFILE_EVF_WRITE 1
+static psvs_profile_entry_t g_profile_db_snapshot[PSVS_PROFILE_DB_MAX]; // worker side
+static uint32_t g_profile_db_gen = 0;     // bumped on every change
+static uint32_t g_profile_written_gen = 0;
+static bool g_profile_write_ok = true;
+static bool g_profile_db_locked = false; // bad db could not be moved aside
+static SceUInt32 g_profile_write_tick = 0; // last write done
+static SceUID g_profile_evf_uid = -1;
+static SceUID g_profile_thread_uid = -1;
+static bool g_profile_thread_run = true;
+
+static uint32_t _psvs_profile_hash(const char *titleid) {
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (int i = 0; i < PSVS_PROFILE_TITLEID_LEN && titleid[i]; i++)
+        hash = (hash ^ (uint8_t)titleid[i]) * 16777619u;
+    return hash;
+}
 
-void psvs_profile_init() {
-    ksceIoMkdir("ur0:data/", 0777);
-    ksceIoMkdir("ur0:data/PSVshell_fork/", 0777);
-    ksceIoMkdir(PSVS_PROFILES_DIR, 0777);
+static int _psvs_profile_db_find(const char *titleid) {
+    uint32_t slot = _psvs_profile_hash(titleid);
+    for (int i = 0; i < PSVS_PROFILE_DB_SLOTS; i++, slot++) {
+        int entry = g_profile_db_index[slot & (PSVS_PROFILE_DB_SLOTS - 1)];
+        if (entry < 0)
+            return -1;
+        if (!strncmp(g_profile_db[entry].titleid, titleid, PSVS_PROFILE_TITLEID_LEN))
+            return entry;
+    }
+    return -1;
+}
+
+static void _psvs_profile_db_index_add(int entry) {
+    uint32_t slot = _psvs_profile_hash(g_profile_db[entry].titleid);
+    while (g_profile_db_index[slot & (PSVS_PROFILE_DB_SLOTS - 1)] >= 0)
+        slot++;
+    g_profile_db_index[slot & (PSVS_PROFILE_DB_SLOTS - 1)] = entry;
+}
+
+static void _psvs_profile_db_reindex() {
+    memset(g_profile_db_index, 0xFF, sizeof(g_profile_db_index));
+    for (int i = 0; i < g_profile_db_n; i++)
+        _psvs_profile_db_index_add(i);
+}
+
+static bool _psvs_profile_db_put(const char *titleid, const psvs_oc_profile_t *oc) {
+    int entry = _psvs_profile_db_find(titleid);
+    if (entry < 0) {
+        if (g_profile_db_n >= PSVS_PROFILE_DB_MAX)
+            return false;
+
+        entry = g_profile_db_n++;
+        memset(&g_profile_db[entry], 0, sizeof(psvs_profile_entry_t));
+        strncpy(g_profile_db[entry].titleid, titleid, PSVS_PROFILE_TITLEID_LEN - 1);
+        _psvs_profile_db_index_add(entry);
+    }
+
+    memcpy(&g_profile_db[entry].profile, oc, sizeof(psvs_oc_profile_t));
+    return true;
+}
+
+static bool _psvs_profile_db_remove(const char *titleid) {
+    int entry = _psvs_profile_db_find(titleid);
+    if (entry < 0)
+        return false;
+
+    // Last entry fills the hole, deletes are rare enough to rebuild index
+    g_profile_db_n--;
+    if (entry != g_profile_db_n)
+        memcpy(&g_profile_db[entry], &g_profile_db[g_profile_db_n], sizeof(psvs_profile_entry_t));
+    _psvs_profile_db_reindex();
+    return true;
+}
+
+// Brings a profile of an older version up to date, size is what was read
+static bool _psvs_profile_upgrade(psvs_oc_profile_t *oc, int size) {
+    // PSVS0110 profiles lack the governor target
+    if (!strncmp(oc->ver, "PSVS0110", 8) && size >= offsetof(psvs_oc_profile_t, target_fps)) {
+        memcpy(oc->ver, PSVS_VERSION_VER, 8);
+        oc->target_fps = PSVS_OC_TARGET_FPS_DEFAULT;
+        return true;
+    }
+
+    return size == sizeof(psvs_oc_profile_t) && !strncmp(oc->ver, PSVS_VERSION_VER, 8);
 }
 
-bool psvs_profile_load_compat() {
-    g_profile_exists = false;
-    g_profile_exists_global = false;
+static bool _psvs_profile_db_write(const psvs_profile_entry_t *entries, int entry_n) {
+    psvs_profile_db_header_t header;
+    memset(&header, 0, sizeof(psvs_profile_db_header_t));
+    memcpy(header.magic, PSVS_PROFILE_DB_MAGIC, sizeof(header.magic));
+    header.version = PSVS_PROFILE_DB_VERSION;
+    header.entry_size = sizeof(psvs_profile_entry_t);
+    header.entry_n = entry_n;
+
+    // Write aside and swap, a failed write leaves the old db intact,
+    // previous db stays as .bak until the new one is in place
+    SceUID fd = ksceIoOpen(PSVS_PROFILE_DB ".tmp", SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+    if (fd < 0)
+        return false;
 
-    SceUID fd = -1;
-    char path[128];
-    snprintf(path, 128, "%s%s", PSVS_COMPAT_PROFILES_DIR, g_titleid);
+    int size = entry_n * sizeof(psvs_profile_entry_t);
+    bool ok = ksceIoWrite(fd, &header, sizeof(header)) == sizeof(header)
+            && (size == 0 || ksceIoWrite(fd, entries, size) == size);
+    ksceIoClose(fd);
 
-    // always check both so we can tell if both of them exist
-    SceUID fd_title = ksceIoOpen(path, SCE_O_RDONLY, 0777);
-    SceUID fd_global = ksceIoOpen(PSVS_COMPAT_PROFILES_DIR "global", SCE_O_RDONLY, 0777);
-    if (fd_title < 0 && fd_global < 0)
+    if (!ok) {
+        ksceIoRemove(PSVS_PROFILE_DB ".tmp");
         return false;
+    }
 
-    // default to global profile
-    if (fd_global >= 0) {
-        fd = fd_global;
+    // Only replace backup if there is a db to take its place
+    SceIoStat stat;
+    if (ksceIoGetstat(PSVS_PROFILE_DB, &stat) >= 0) {
+        ksceIoRemove(PSVS_PROFILE_DB ".bak");
+        ksceIoRename(PSVS_PROFILE_DB, PSVS_PROFILE_DB ".bak");
+    }
+    return ksceIoRename(PSVS_PROFILE_DB ".tmp", PSVS_PROFILE_DB) >= 0;
+}
+
+static psvs_profile_db_state_t _psvs_profile_db_read(const char *path) {
+    SceUID fd = ksceIoOpen(path, SCE_O_RDONLY, 0777);
+    if (fd < 0)
+        return PSVS_PROFILE_DB_MISSING;
+
+    psvs_profile_db_header_t header;
+    int bytes = ksceIoRead(fd, &header, sizeof(header));
+    if (bytes != sizeof(header)
+            || memcmp(header.magic, PSVS_PROFILE_DB_MAGIC, sizeof(header.magic))
+            || header.version != PSVS_PROFILE_DB_VERSION
+            || header.entry_size < offsetof(psvs_profile_entry_t, profile.target_fps)
+            || header.entry_size > sizeof(psvs_profile_entry_t)) {
+        ksceIoClose(fd);
+        return PSVS_PROFILE_DB_BAD;
     }
 
-    // if present, title profile has precedence
-    if (fd_title >= 0) {
-        fd = fd_title;
-        if (fd_global >= 0) // global profile is not needed when both are present
-            ksceIoClose(fd_global);
+    // Entries may be of an older, shorter profile layout
+    int n = header.entry_n < PSVS_PROFILE_DB_MAX ? header.entry_n : PSVS_PROFILE_DB_MAX;
+    int profile_size = header.entry_size - offsetof(psvs_profile_entry_t, profile);
+    for (g_profile_db_n = 0; g_profile_db_n < n; g_profile_db_n++) {
+        psvs_profile_entry_t *entry = &g_profile_db[g_profile_db_n];
+        memset(entry, 0, sizeof(psvs_profile_entry_t));
+        if (ksceIoRead(fd, entry, header.entry_size) != header.entry_size)
+            break;
+
+        // Unknown versions are kept as they are, load skips them
+        entry->titleid[PSVS_PROFILE_TITLEID_LEN - 1] = '\0';
+        _psvs_profile_upgrade(&entry->profile, profile_size);
     }
+    ksceIoClose(fd);
+
+    _psvs_profile_db_reindex();
+    return PSVS_PROFILE_DB_OK;
+}
+
+// Per-title files, PSVS0110 and later
+static bool _psvs_profile_read_file(const char *path, psvs_oc_profile_t *oc) {
+    SceUID fd = ksceIoOpen(path, SCE_O_RDONLY, 0777);
+    if (fd < 0)
+        return false;
+
+    int bytes = ksceIoRead(fd, oc, sizeof(psvs_oc_profile_t));
+    ksceIoClose(fd);
+
+    return _psvs_profile_upgrade(oc, bytes);
+}
+
+// Per-title files of official PSVshell, PSVS0100
+static bool _psvs_profile_read_compat_file(const char *path, psvs_oc_profile_t *new_oc) {
+    SceUID fd = ksceIoOpen(path, SCE_O_RDONLY, 0777);
+    if (fd < 0)
+        return false;
 
     psvs_oc_compat_profile_t oc;
     int bytes = ksceIoRead(fd, &oc, sizeof(psvs_oc_compat_profile_t));
@@ -62,119 +210,191 @@ bool psvs_profile_load_compat() {
         return false;
 
     // convert to new format
-    psvs_oc_profile_t new_oc = {
-            .ver = PSVS_VERSION_VER,
-    };
+    memset(new_oc, 0, sizeof(psvs_oc_profile_t));
+    memcpy(new_oc->ver, PSVS_VERSION_VER, 8);
     for (int i = 0; i < PSVS_OC_DEVICE_VENEZIA; i++) {
-        new_oc.mode[i] = oc.mode[i];
-        new_oc.manual_freq[i] = oc.manual_freq[i];
+        new_oc->mode[i] = oc.mode[i];
+        new_oc->manual_freq[i] = oc.manual_freq[i];
     }
-    new_oc.mode[PSVS_OC_DEVICE_VENEZIA] = PSVS_OC_MODE_DEFAULT;
-
-    psvs_oc_set_profile(&new_oc);
+    new_oc->mode[PSVS_OC_DEVICE_VENEZIA] = PSVS_OC_MODE_DEFAULT;
+    new_oc->target_fps = PSVS_OC_TARGET_FPS_DEFAULT;
     return true;
 }
 
-bool psvs_profile_load_new() {
-    g_profile_exists = false;
-    g_profile_exists_global = false;
+// Imports every profile file in dir not in db yet
+static void _psvs_profile_migrate_dir(const char *dir, bool compat) {
+    SceUID dfd = ksceIoDopen(dir);
+    if (dfd < 0)
+        return;
 
-    SceUID fd = -1;
-    char path[128];
-    snprintf(path, 128, "%s%s", PSVS_PROFILES_DIR, g_titleid);
+    SceIoDirent dirent;
+    memset(&dirent, 0, sizeof(SceIoDirent));
+    while (ksceIoDread(dfd, &dirent) > 0) {
+        if (!SCE_S_ISREG(dirent.d_stat.st_mode) || _psvs_profile_db_find(dirent.d_name) >= 0)
+            continue;
 
-    // always check both so we can tell if both of them exist
-    SceUID fd_title = ksceIoOpen(path, SCE_O_RDONLY, 0777);
-    SceUID fd_global = ksceIoOpen(PSVS_PROFILES_DIR "global", SCE_O_RDONLY, 0777);
-    if (fd_title < 0 && fd_global < 0)
-        return false;
+        char path[128];
+        snprintf(path, 128, "%s%s", dir, dirent.d_name);
 
-    // default to global profile
-    if (fd_global >= 0) {
-        fd = fd_global;
-        g_profile_exists_global = true;
+        psvs_oc_profile_t oc;
+        bool ok = compat ? _psvs_profile_read_compat_file(path, &oc) : _psvs_profile_read_file(path, &oc);
+        if (ok)
+            _psvs_profile_db_put(dirent.d_name, &oc);
     }
 
-    // if present, title profile has precedence
-    if (fd_title >= 0) {
-        fd = fd_title;
-        g_profile_exists = true;
-        if (fd_global >= 0) // global profile is not needed when both are present
-            ksceIoClose(fd_global);
-    }
+    ksceIoDclose(dfd);
+}
 
-    psvs_oc_profile_t oc;
-    int bytes = ksceIoRead(fd, &oc, sizeof(psvs_oc_profile_t));
-    ksceIoClose(fd);
+// Writes db if changed since last write, file I/O happens unlocked
+static void _psvs_profile_flush() {
+    ksceKernelLockMutex(g_profile_mutex_uid, 1, NULL);
+    uint32_t gen = g_profile_db_gen;
+    int entry_n = g_profile_db_n;
+    if (gen != g_profile_written_gen)
+        memcpy(g_profile_db_snapshot, g_profile_db, entry_n * sizeof(psvs_profile_entry_t));
+    ksceKernelUnlockMutex(g_profile_mutex_uid, 1);
+
+    if (gen == g_profile_written_gen)
+        return;
+
+    g_profile_write_ok = !g_profile_db_locked && _psvs_profile_db_write(g_profile_db_snapshot, entry_n);
+    g_profile_write_tick = ksceKernelGetProcessTimeLowCore();
+    __atomic_store_n(&g_profile_written_gen, gen, __ATOMIC_RELEASE);
+}
 
-    if (bytes != sizeof(psvs_oc_profile_t))
-        return false;
+static int psvs_profile_thread(SceSize args, void *argp) {
+    while (g_profile_thread_run) {
+        ksceKernelWaitEventFlag(g_profile_evf_uid, PSVS_PROFILE_EVF_WRITE,
+                                SCE_KERNEL_EVF_WAITMODE_OR | SCE_KERNEL_EVF_WAITMODE_CLEAR_ALL, NULL, NULL);
 
-    if (strncmp(oc.ver, PSVS_VERSION_VER, 8))
-        return false;
+        // Let quick successive changes pile up into one write
+        ksceKernelDelayThread(PSVS_PROFILE_WRITE_DELAY);
+        _psvs_profile_flush();
+    }
 
-    psvs_oc_set_profile(&oc);
-    return true;
+    // Don't lose changes on unload
+    _psvs_profile_flush();
+    return 0;
 }
 
-bool psvs_profile_load() {
-    if (!psvs_profile_load_new())
-        // if failed, try to load official psvs profile
-        return psvs_profile_load_compat();
-    return true;
+static void _psvs_profile_changed() {
+    g_profile_db_gen++;
+    ksceKernelSetEventFlag(g_profile_evf_uid, PSVS_PROFILE_EVF_WRITE);
 }
 
-bool psvs_profile_save(bool global) {
-    SceUID fd;
+psvs_profile_write_t psvs_profile_get_write_state() {
+    if (__atomic_load_n(&g_profile_written_gen, __ATOMIC_ACQUIRE) != g_profile_db_gen)
+        return PSVS_PROFILE_WRITE_PENDING;
+    if (!g_profile_write_tick || ksceKernelGetProcessTimeLowCore() - g_profile_write_tick >= PSVS_PROFILE_SAVED_SHOW)
+        return PSVS_PROFILE_WRITE_IDLE;
+    return g_profile_write_ok ? PSVS_PROFILE_WRITE_SAVED : PSVS_PROFILE_WRITE_FAILED;
+}
 
-    if (!global) {
-        char path[128];
-        snprintf(path, 128, "%s%s", PSVS_PROFILES_DIR, g_titleid);
-        fd = ksceIoOpen(path, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
-    } else {
-        fd = ksceIoOpen(PSVS_PROFILES_DIR "global", SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+void psvs_profile_init() {
+    ksceIoMkdir("ur0:data/", 0777);
+    ksceIoMkdir("ur0:data/PSVshell_fork/", 0777);
+
+    g_profile_mutex_uid = ksceKernelCreateMutex("psvs_mutex_profile", 0, 0, NULL);
+    g_profile_evf_uid = ksceKernelCreateEventFlag("psvs_profile_evf", 0, 0, NULL);
+
+    g_profile_thread_run = true;
+    g_profile_db_locked = false;
+    g_profile_db_n = 0;
+    _psvs_profile_db_reindex();
+    const char *path = PSVS_PROFILE_DB;
+    psvs_profile_db_state_t state = _psvs_profile_db_read(path);
+    if (state == PSVS_PROFILE_DB_MISSING) {
+        // Interrupted swap, previous db is still there
+        path = PSVS_PROFILE_DB ".bak";
+        state = _psvs_profile_db_read(path);
+        if (state == PSVS_PROFILE_DB_OK)
+            _psvs_profile_changed();
     }
 
-    if (fd < 0)
-        return false;
+    if (state == PSVS_PROFILE_DB_BAD) {
+        // Keep unreadable db for the user, start over next to it
+        ksceIoRemove(PSVS_PROFILE_DB ".bad");
+        if (ksceIoRename(path, PSVS_PROFILE_DB ".bad") < 0)
+            g_profile_db_locked = true;
+    }
 
-    int bytes = ksceIoWrite(fd, psvs_oc_get_profile(), sizeof(psvs_oc_profile_t));
-    ksceIoClose(fd);
+    if (state != PSVS_PROFILE_DB_OK) {
+        // First run with db, take over per-title files once, ours win over official ones
+        _psvs_profile_migrate_dir(PSVS_PROFILES_DIR, false);
+        _psvs_profile_migrate_dir(PSVS_COMPAT_PROFILES_DIR, true);
+        _psvs_profile_changed();
+    }
 
-    if (bytes != sizeof(psvs_oc_profile_t))
-        return false;
+    // Low priority, memory card writes must not stall psvs_thread
+    g_profile_thread_uid = ksceKernelCreateThread("psvs_profile_thread", psvs_profile_thread, 0xA0, 0x2000, 0, 0x10000, 0);
+    if (g_profile_thread_uid >= 0)
+        ksceKernelStartThread(g_profile_thread_uid, 0, NULL);
+    else // no worker, write now
+        _psvs_profile_flush();
+}
 
-    // mark profile as present
-    if (global) {
-        g_profile_exists_global = true;
-    } else {
-        g_profile_exists = true;
-        psvs_oc_set_changed(false);
+// Transition gets clock change timings if not NULL
+bool psvs_profile_load(psvs_oc_transition_t *transition) {
+    psvs_oc_profile_t oc;
+    bool found = false;
+
+    ksceKernelLockMutex(g_profile_mutex_uid, 1, NULL);
+    int entry = _psvs_profile_db_find(g_titleid);
+    if (entry < 0 || strncmp(g_profile_db[entry].profile.ver, PSVS_VERSION_VER, 8))
+        entry = _psvs_profile_db_find(PSVS_PROFILE_GLOBAL); // default to global profile
+    if (entry >= 0 && !strncmp(g_profile_db[entry].profile.ver, PSVS_VERSION_VER, 8)) {
+        memcpy(&oc, &g_profile_db[entry].profile, sizeof(psvs_oc_profile_t));
+        found = true;
     }
+    ksceKernelUnlockMutex(g_profile_mutex_uid, 1);
 
-    return true;
+    if (found)
+        psvs_oc_set_profile(&oc, transition);
+    return found;
 }
 
-bool psvs_profile_delete(bool global) {
-    if (!global) {
-        char path[128];
-        snprintf(path, 128, "%s%s", PSVS_PROFILES_DIR, g_titleid);
+// Updates db in memory, the file is written by the worker
+bool psvs_profile_save(bool global) {
+    ksceKernelLockMutex(g_profile_mutex_uid, 1, NULL);
+    bool ok = _psvs_profile_db_put(global ? PSVS_PROFILE_GLOBAL : g_titleid, psvs_oc_get_profile());
+    if (ok)
+        _psvs_profile_changed();
+    ksceKernelUnlockMutex(g_profile_mutex_uid, 1);
 
-        if (ksceIoRemove(path) < 0)
-            return false;
+    if (ok && !global)
+        psvs_oc_set_changed(false);
+    return ok;
+}
 
-        g_profile_exists = false;
+bool psvs_profile_delete(bool global) {
+    ksceKernelLockMutex(g_profile_mutex_uid, 1, NULL);
+    bool ok = _psvs_profile_db_remove(global ? PSVS_PROFILE_GLOBAL : g_titleid);
+    if (ok)
+        _psvs_profile_changed();
+    ksceKernelUnlockMutex(g_profile_mutex_uid, 1);
+
+    if (ok && !global)
         psvs_oc_set_changed(true);
-    } else {
-        if (ksceIoRemove(PSVS_PROFILES_DIR "global") < 0)
-            return false;
+    return ok;
+}
 
-        g_profile_exists_global = false;
+void psvs_profile_deinit() {
+    if (g_profile_thread_uid >= 0) {
+        g_profile_thread_run = false;
+        ksceKernelSetEventFlag(g_profile_evf_uid, PSVS_PROFILE_EVF_WRITE);
+        ksceKernelWaitThreadEnd(g_profile_thread_uid, NULL, NULL);
+        ksceKernelDeleteThread(g_profile_thread_uid);
     }
 
-    return true;
+    if (g_profile_evf_uid >= 0)
+        ksceKernelDeleteEventFlag(g_profile_evf_uid);
+    if (g_profile_mutex_uid >= 0)
+        ksceKernelDeleteMutex(g_profile_mutex_uid);
 }
 
 bool psvs_profile_exists(bool global) {
-    return global ? g_profile_exists_global : g_profile_exists;
+    ksceKernelLockMutex(g_profile_mutex_uid, 1, NULL);
+    bool exists = _psvs_profile_db_find(global ? PSVS_PROFILE_GLOBAL : g_titleid) >= 0;
+    ksceKernelUnlockMutex(g_profile_mutex_uid, 1);
+    return exists;
 }
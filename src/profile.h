@@ -1,10 +1,48 @@
 #ifndef _PROFILE_H_
 #define _PROFILE_H_
 
+// All profiles live in one file, indexed by titleid in memory
+#define PSVS_PROFILE_DB "ur0:data/PSVshell_fork/profiles.db"
+#define PSVS_PROFILE_DB_MAGIC "PSVSPDB"
+#define PSVS_PROFILE_DB_VERSION 1
+#define PSVS_PROFILE_DB_MAX 256   // entries
+#define PSVS_PROFILE_DB_SLOTS 512 // hash slots, must be power of 2
+#define PSVS_PROFILE_TITLEID_LEN 16
+#define PSVS_PROFILE_GLOBAL "global"
+
+// Per-title files, migrated into the db once
+#define PSVS_PROFILES_DIR "ur0:data/PSVshell_fork/profiles/"
+#define PSVS_COMPAT_PROFILES_DIR "ur0:data/PSVshell/profiles/"
+
+#define PSVS_PROFILE_WRITE_DELAY 200 * 1000   // us, changes within coalesce
+#define PSVS_PROFILE_SAVED_SHOW 2000 * 1000   // us write result stays in menu
+
+typedef enum {
+    PSVS_PROFILE_WRITE_IDLE,
+    PSVS_PROFILE_WRITE_PENDING, // db changed, not on disk yet
+    PSVS_PROFILE_WRITE_SAVED,   // written just now
+    PSVS_PROFILE_WRITE_FAILED   // last write failed
+} psvs_profile_write_t;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t entry_size;
+    uint32_t entry_n;
+    uint32_t reserved;
+} psvs_profile_db_header_t;
+
+typedef struct {
+    char titleid[PSVS_PROFILE_TITLEID_LEN];
+    psvs_oc_profile_t profile;
+} psvs_profile_entry_t;
+
 void psvs_profile_init();
-bool psvs_profile_load();
+void psvs_profile_deinit();
+bool psvs_profile_load(psvs_oc_transition_t *transition);
 bool psvs_profile_save(bool global);
 bool psvs_profile_delete(bool global);
 bool psvs_profile_exists(bool global);
+psvs_profile_write_t psvs_profile_get_write_state();
 
 #endif
@@ -0,0 +1,263 @@
+#include <vitasdkkern.h>
+#include <taihen.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "oc.h"
+#include "perf.h"
+#include "session.h"
+
+static const char *g_session_device_names[PSVS_OC_DEVICE_MAX] = {
+    "CPU", "ES4", "BUS", "XBR", "VNZ"
+};
+
+static psvs_session_t g_session = {0};
+static psvs_frametime_hist_t g_session_hist;
+static uint32_t g_session_frame_last = 0;
+static uint64_t g_session_tick_last = 0;
+static uint32_t g_session_us_rem = 0; // below 1ms, carried to next update
+static uint64_t g_session_load_sum[4];
+static uint32_t g_session_load_n = 0;
+static SceDateTime g_session_start_time;
+static psvs_oc_profile_t g_session_profile;
+
+// Report is formatted on psvs_thread and appended by a low priority worker
+#define PSVS_SESSION_EVF_WRITE 1
+static char g_session_report[PSVS_SESSION_REPORT_MAX];
+static char g_session_report_path[128];
+static int g_session_report_len = 0; // 0 = nothing to write
+static SceUID g_session_report_mutex_uid = -1;
+static SceUID g_session_evf_uid = -1;
+static SceUID g_session_thread_uid = -1;
+static bool g_session_thread_run = true;
+
+bool psvs_session_is_running() {
+    return g_session.state == PSVS_SESSION_STATE_RUNNING;
+}
+
+const psvs_session_t *psvs_session_get() {
+    return &g_session;
+}
+
+static void _psvs_session_start() {
+    memset(&g_session, 0, sizeof(psvs_session_t));
+    memset(&g_session_hist, 0, sizeof(psvs_frametime_hist_t));
+    memset(g_session_load_sum, 0, sizeof(g_session_load_sum));
+    g_session_load_n = 0;
+    g_session_us_rem = 0;
+
+    g_session_frame_last = psvs_perf_get_frame_count();
+    g_session_tick_last = ksceKernelGetSystemTimeWide();
+    ksceRtcGetCurrentClockLocalTime(&g_session_start_time);
+    memcpy(&g_session_profile, psvs_oc_get_profile(), sizeof(psvs_oc_profile_t));
+
+    g_session.batt_start = g_session.batt_end = psvs_perf_get_batt()->percent;
+    g_session.state = PSVS_SESSION_STATE_RUNNING;
+}
+
+static void _psvs_session_add_residency(psvs_oc_device_t device, int freq, uint32_t time) {
+    psvs_session_residency_t *res = g_session.residency[device];
+
+    for (int i = 0; i < PSVS_SESSION_FREQ_N; i++) {
+        if (res[i].freq == freq || res[i].freq == 0 || i == PSVS_SESSION_FREQ_N - 1) {
+            res[i].freq = (res[i].freq == 0) ? freq : res[i].freq; // last slot collects the rest
+            res[i].time += time;
+            return;
+        }
+    }
+}
+
+// Called from psvs_thread after polling perf
+void psvs_session_update() {
+    if (g_session.state != PSVS_SESSION_STATE_RUNNING)
+        return;
+
+    uint64_t tick_now = ksceKernelGetSystemTimeWide();
+    uint32_t us = (uint32_t)(tick_now - g_session_tick_last) + g_session_us_rem;
+    uint32_t ms = us / 1000;
+    g_session_us_rem = us % 1000;
+    g_session_tick_last = tick_now;
+
+    // Collect frames since last update, older ones are gone from history
+    uint32_t count = psvs_perf_get_frame_count();
+    if (count - g_session_frame_last > PSVS_PERF_FRAMETIME_HISTORY)
+        g_session_frame_last = count - PSVS_PERF_FRAMETIME_HISTORY;
+    for (; g_session_frame_last != count; g_session_frame_last++) {
+        psvs_perf_hist_add(&g_session_hist, psvs_perf_get_frametime(g_session_frame_last));
+        g_session.frames++;
+    }
+
+    g_session.time += ms;
+    if (g_session.time > 0)
+        g_session.fps10 = ((uint64_t)g_session.frames * 10000 + g_session.time / 2) / g_session.time;
+    psvs_perf_hist_stats(&g_session_hist, g_session.frames, &g_session.frametime);
+
+    // Load
+    g_session_load_n++;
+    for (int i = 0; i < 4; i++) {
+        int load = psvs_perf_get_load(i);
+        g_session_load_sum[i] += load;
+        g_session.load_avg[i] = g_session_load_sum[i] / g_session_load_n;
+        if (load > g_session.load_peak[i])
+            g_session.load_peak[i] = load;
+    }
+
+    // Clock residency
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++)
+        _psvs_session_add_residency(i, psvs_oc_get_freq(i), ms);
+
+    g_session.batt_end = psvs_perf_get_batt()->percent;
+}
+
+// Appends report queued by _psvs_session_format_report(), file I/O happens unlocked
+static void _psvs_session_flush_report() {
+    static char buf[PSVS_SESSION_REPORT_MAX];
+    char path[128];
+
+    ksceKernelLockMutex(g_session_report_mutex_uid, 1, NULL);
+    int len = g_session_report_len;
+    memcpy(buf, g_session_report, len);
+    memcpy(path, g_session_report_path, sizeof(path));
+    g_session_report_len = 0;
+    ksceKernelUnlockMutex(g_session_report_mutex_uid, 1);
+
+    if (len == 0)
+        return;
+
+    SceUID fd = ksceIoOpen(path, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_APPEND, 0777);
+    if (fd < 0)
+        return;
+
+    ksceIoWrite(fd, buf, len);
+    ksceIoClose(fd);
+}
+
+static int psvs_session_thread(SceSize args, void *argp) {
+    while (g_session_thread_run) {
+        ksceKernelWaitEventFlag(g_session_evf_uid, PSVS_SESSION_EVF_WRITE,
+                                SCE_KERNEL_EVF_WAITMODE_OR | SCE_KERNEL_EVF_WAITMODE_CLEAR_ALL, NULL, NULL);
+        _psvs_session_flush_report();
+    }
+
+    // Don't lose the report on unload
+    _psvs_session_flush_report();
+    return 0;
+}
+
+static void _psvs_session_format_report() {
+    char buf[PSVS_SESSION_REPORT_MAX];
+    int len = 0;
+    const psvs_session_t *s = &g_session;
+    const psvs_frametime_stats_t *ft = &s->frametime;
+
+#define REPORT(...) do { \
+        if (len < sizeof(buf)) \
+            len += snprintf(&buf[len], sizeof(buf) - len, __VA_ARGS__); \
+    } while (0)
+
+    REPORT("== %s %04d-%02d-%02d %02d:%02d:%02d ==\n", g_titleid,
+           g_session_start_time.year, g_session_start_time.month, g_session_start_time.day,
+           g_session_start_time.hour, g_session_start_time.minute, g_session_start_time.second);
+
+    REPORT("profile:  ");
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        if (g_session_profile.mode[i] == PSVS_OC_MODE_MANUAL)
+            REPORT(" %s %d", g_session_device_names[i], g_session_profile.manual_freq[i]);
+        else if (g_session_profile.mode[i] == PSVS_OC_MODE_GOVERNOR)
+            REPORT(" %s auto@%d", g_session_device_names[i], g_session_profile.target_fps);
+        else
+            REPORT(" %s default", g_session_device_names[i]);
+    }
+    REPORT("\n");
+
+    REPORT("duration:  %u.%u s, %u frames, avg %d.%d fps\n",
+           s->time / 1000, (s->time % 1000) / 100, s->frames, s->fps10 / 10, s->fps10 % 10);
+    REPORT("frametime: p50 %u.%u ms, p99 %u.%u ms, p99.9 %u.%u ms, 1%% low %d fps\n",
+           ft->p50 / 1000, (ft->p50 % 1000) / 100,
+           ft->p99 / 1000, (ft->p99 % 1000) / 100,
+           ft->p99_9 / 1000, (ft->p99_9 % 1000) / 100,
+           ft->low_1);
+    REPORT("load avg:  %d%% %d%% %d%% %d%%\n", s->load_avg[0], s->load_avg[1], s->load_avg[2], s->load_avg[3]);
+    REPORT("load peak: %d%% %d%% %d%% %d%%\n", s->load_peak[0], s->load_peak[1], s->load_peak[2], s->load_peak[3]);
+
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        REPORT("%s:      ", g_session_device_names[i]);
+        for (int j = 0; j < PSVS_SESSION_FREQ_N && s->residency[i][j].freq; j++) {
+            uint32_t permille = s->time ? ((uint64_t)s->residency[i][j].time * 1000) / s->time : 0;
+            REPORT(" %d MHz %u.%u%%", s->residency[i][j].freq, permille / 10, permille % 10);
+        }
+        REPORT("\n");
+    }
+
+    if (g_is_dolce) {
+        REPORT("battery:   A/C\n");
+    } else {
+        int drain = s->batt_start - s->batt_end;
+        int drain10_h = s->time ? ((int64_t)drain * 36000000) / (int)s->time : 0; // %/h x10
+        REPORT("battery:   %d%% -> %d%%, %d.%d%%/h, %d C\n", s->batt_start, s->batt_end,
+               drain10_h / 10, (drain10_h < 0 ? -drain10_h : drain10_h) % 10, psvs_perf_get_batt()->temp);
+    }
+    REPORT("\n");
+
+#undef REPORT
+
+    if (len > sizeof(buf) - 1)
+        len = sizeof(buf) - 1;
+
+    // Queue for the worker, memory card writes must not stall psvs_thread
+    ksceKernelLockMutex(g_session_report_mutex_uid, 1, NULL);
+    memcpy(g_session_report, buf, len);
+    g_session_report_len = len;
+    snprintf(g_session_report_path, sizeof(g_session_report_path), "%s%s.txt", PSVS_SESSION_DIR, g_titleid);
+    ksceKernelUnlockMutex(g_session_report_mutex_uid, 1);
+
+    if (g_session_thread_uid >= 0)
+        ksceKernelSetEventFlag(g_session_evf_uid, PSVS_SESSION_EVF_WRITE);
+    else // no worker, write now
+        _psvs_session_flush_report();
+}
+
+// Cycles idle -> running -> done (summary) -> idle
+void psvs_session_toggle() {
+    switch (g_session.state) {
+        case PSVS_SESSION_STATE_IDLE:
+            _psvs_session_start();
+            break;
+        case PSVS_SESSION_STATE_RUNNING:
+            psvs_session_update(); // include time since last update
+            g_session.state = PSVS_SESSION_STATE_DONE;
+            _psvs_session_format_report();
+            break;
+        case PSVS_SESSION_STATE_DONE:
+            g_session.state = PSVS_SESSION_STATE_IDLE;
+            break;
+    }
+}
+
+void psvs_session_init() {
+    ksceIoMkdir(PSVS_SESSION_DIR, 0777);
+
+    g_session_report_mutex_uid = ksceKernelCreateMutex("psvs_mutex_session", 0, 0, NULL);
+    g_session_evf_uid = ksceKernelCreateEventFlag("psvs_session_evf", 0, 0, NULL);
+
+    // Low priority, like the profile writer
+    g_session_thread_uid = ksceKernelCreateThread("psvs_session_thread", psvs_session_thread, 0xA0, 0x2000, 0, 0x10000, 0);
+    if (g_session_thread_uid >= 0)
+        ksceKernelStartThread(g_session_thread_uid, 0, NULL);
+}
+
+void psvs_session_deinit() {
+    if (g_session_thread_uid >= 0) {
+        g_session_thread_run = false;
+        ksceKernelSetEventFlag(g_session_evf_uid, PSVS_SESSION_EVF_WRITE);
+        ksceKernelWaitThreadEnd(g_session_thread_uid, NULL, NULL);
+        ksceKernelDeleteThread(g_session_thread_uid);
+    }
+
+    if (g_session_evf_uid >= 0)
+        ksceKernelDeleteEventFlag(g_session_evf_uid);
+    if (g_session_report_mutex_uid >= 0)
+        ksceKernelDeleteMutex(g_session_report_mutex_uid);
+}
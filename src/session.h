@@ -0,0 +1,41 @@
+#ifndef _SESSION_H_
+#define _SESSION_H_
+
+#define PSVS_SESSION_DIR "ur0:data/PSVshell_fork/sessions/"
+
+#define PSVS_SESSION_FREQ_N 8 // distinct freqs tracked per device
+#define PSVS_SESSION_REPORT_MAX 1024 // bytes of one report
+
+typedef enum {
+    PSVS_SESSION_STATE_IDLE,
+    PSVS_SESSION_STATE_RUNNING,
+    PSVS_SESSION_STATE_DONE, // summary shown until dismissed
+} psvs_session_state_t;
+
+typedef struct {
+    int freq;      // MHz, 0 = unused slot
+    uint32_t time; // ms
+} psvs_session_residency_t;
+
+typedef struct {
+    psvs_session_state_t state;
+    uint32_t time;   // ms
+    uint32_t frames;
+    int fps10;       // avg FPS x10
+    psvs_frametime_stats_t frametime;
+    int load_avg[4];
+    int load_peak[4];
+    psvs_session_residency_t residency[PSVS_OC_DEVICE_MAX][PSVS_SESSION_FREQ_N];
+    int batt_start;  // %
+    int batt_end;
+} psvs_session_t;
+
+void psvs_session_toggle();
+void psvs_session_update();
+bool psvs_session_is_running();
+const psvs_session_t *psvs_session_get();
+
+void psvs_session_init();
+void psvs_session_deinit();
+
+#endif
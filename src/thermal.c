@@ -0,0 +1,203 @@
+#include <vitasdkkern.h>
+#include <taihen.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "oc.h"
+#include "perf.h"
+#include "thermal.h"
+
+SceUInt32 ksceKernelGetProcessTimeLowCore();
+
+static const char *g_thermal_level_names[PSVS_THERMAL_LEVEL_MAX] = {
+    "normal", "warm", "hot"
+};
+
+static const char *g_thermal_device_names[PSVS_OC_DEVICE_MAX] = {
+    "CPU", "ES4", "BUS", "XBR", "VNZ"
+};
+
+// Clock ceiling per level, 0 = none
+static const int g_thermal_ceiling[PSVS_THERMAL_LEVEL_MAX][PSVS_OC_DEVICE_MAX] = {
+    [PSVS_THERMAL_LEVEL_NORMAL] = {0},
+    [PSVS_THERMAL_LEVEL_WARM] = {
+        [PSVS_OC_DEVICE_CPU] = 444
+    },
+    [PSVS_THERMAL_LEVEL_HOT] = {
+        [PSVS_OC_DEVICE_CPU] = 333,
+        [PSVS_OC_DEVICE_GPU_ES4] = 166,
+        [PSVS_OC_DEVICE_BUS] = 166,
+        [PSVS_OC_DEVICE_GPU_XBAR] = 111
+    },
+};
+
+static psvs_thermal_config_t g_thermal_config = {
+    .warm = PSVS_THERMAL_WARM_DEFAULT,
+    .hot = PSVS_THERMAL_HOT_DEFAULT,
+    .hysteresis = PSVS_THERMAL_HYSTERESIS_DEFAULT
+};
+static psvs_thermal_level_t g_thermal_level = PSVS_THERMAL_LEVEL_NORMAL;
+static SceUInt32 g_thermal_tick_last = 0;
+
+psvs_thermal_level_t psvs_thermal_get_level() {
+    return g_thermal_level;
+}
+
+// Only manual/governor clocks get capped, so only those need watching
+bool psvs_thermal_is_active() {
+    if (g_is_dolce)
+        return false;
+    if (g_thermal_level != PSVS_THERMAL_LEVEL_NORMAL)
+        return true;
+
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX; i++) {
+        if (psvs_oc_get_mode(i) != PSVS_OC_MODE_DEFAULT)
+            return true;
+    }
+    return false;
+}
+
+static int _psvs_thermal_get_threshold(psvs_thermal_level_t level) {
+    switch (level) {
+        case PSVS_THERMAL_LEVEL_WARM: return g_thermal_config.warm;
+        case PSVS_THERMAL_LEVEL_HOT:  return g_thermal_config.hot;
+        default: return 0;
+    }
+}
+
+static void _psvs_thermal_log(int temp) {
+    SceUID fd = psvs_log_open(PSVS_THERMAL_LOG, PSVS_THERMAL_LOG ".old");
+    if (fd < 0)
+        return;
+
+    SceDateTime time;
+    ksceRtcGetCurrentClockLocalTime(&time);
+
+    char buf[160];
+    int len = snprintf(buf, sizeof(buf), "%04d-%02d-%02d %02d:%02d:%02d %-9s %2dC %s",
+                       time.year, time.month, time.day, time.hour, time.minute, time.second,
+                       g_titleid, temp, g_thermal_level_names[g_thermal_level]);
+    for (int i = 0; i < PSVS_OC_DEVICE_MAX && len < sizeof(buf); i++) {
+        int ceiling = g_thermal_ceiling[g_thermal_level][i];
+        if (ceiling)
+            len += snprintf(&buf[len], sizeof(buf) - len, " %s<=%d", g_thermal_device_names[i], ceiling);
+    }
+    if (len < sizeof(buf))
+        len += snprintf(&buf[len], sizeof(buf) - len, "\n");
+    if (len > sizeof(buf) - 1)
+        len = sizeof(buf) - 1;
+
+    ksceIoWrite(fd, buf, len);
+    ksceIoClose(fd);
+}
+
+static void _psvs_thermal_set_level(psvs_thermal_level_t level, int temp) {
+    g_thermal_level = level;
+    psvs_oc_set_ceilings(g_thermal_ceiling[level]);
+
+    _psvs_thermal_log(temp);
+}
+
+// Called from psvs_thread after polling perf
+void psvs_thermal_update() {
+    if (!psvs_thermal_is_active())
+        return;
+
+    SceUInt32 tick_now = ksceKernelGetProcessTimeLowCore();
+    if (tick_now - g_thermal_tick_last < PSVS_THERMAL_INTERVAL)
+        return;
+    g_thermal_tick_last = tick_now;
+
+    int temp = psvs_perf_get_batt()->temp;
+    if (temp <= 0)
+        return; // not read yet
+
+    // Up as soon as a threshold is reached, down once well below it
+    psvs_thermal_level_t level = g_thermal_level;
+    while (level < PSVS_THERMAL_LEVEL_MAX - 1 && temp >= _psvs_thermal_get_threshold(level + 1))
+        level++;
+    while (level > PSVS_THERMAL_LEVEL_NORMAL
+            && temp <= _psvs_thermal_get_threshold(level) - g_thermal_config.hysteresis)
+        level--;
+
+    if (level != g_thermal_level)
+        _psvs_thermal_set_level(level, temp);
+}
+
+static void _psvs_thermal_write_config() {
+    SceUID fd = ksceIoOpen(PSVS_THERMAL_CONFIG, SCE_O_WRONLY | SCE_O_CREAT | SCE_O_TRUNC, 0777);
+    if (fd < 0)
+        return;
+
+    char buf[64];
+    int len = snprintf(buf, sizeof(buf), "warm=%d\nhot=%d\nhysteresis=%d\n",
+                       g_thermal_config.warm, g_thermal_config.hot, g_thermal_config.hysteresis);
+    ksceIoWrite(fd, buf, len);
+    ksceIoClose(fd);
+}
+
+// "key=value" lines, unknown keys and values without digits are ignored
+static void _psvs_thermal_parse_config(const char *buf) {
+    while (*buf) {
+        const char *eq = buf;
+        while (*eq && *eq != '=' && *eq != '\n')
+            eq++;
+
+        const char *p = eq + 1;
+        while (*eq == '=' && *p == ' ')
+            p++;
+
+        if (*eq == '=' && *p >= '0' && *p <= '9') {
+            int value = 0;
+            while (*p >= '0' && *p <= '9') {
+                if (value < 1000) // clamped below anyway
+                    value = value * 10 + (*p - '0');
+                p++;
+            }
+
+            int key_len = eq - buf;
+            while (key_len > 0 && buf[key_len - 1] == ' ')
+                key_len--;
+            if (key_len == 4 && !strncmp(buf, "warm", 4))
+                g_thermal_config.warm = value;
+            else if (key_len == 3 && !strncmp(buf, "hot", 3))
+                g_thermal_config.hot = value;
+            else if (key_len == 10 && !strncmp(buf, "hysteresis", 10))
+                g_thermal_config.hysteresis = value;
+        }
+
+        while (*buf && *buf != '\n')
+            buf++;
+        if (*buf)
+            buf++;
+    }
+}
+
+static int _psvs_thermal_clamp(int value, int min, int max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+void psvs_thermal_init() {
+    SceUID fd = ksceIoOpen(PSVS_THERMAL_CONFIG, SCE_O_RDONLY, 0777);
+    if (fd < 0) {
+        // Leave defaults where they can be found and edited
+        _psvs_thermal_write_config();
+        return;
+    }
+
+    char buf[128];
+    int bytes = ksceIoRead(fd, buf, sizeof(buf) - 1);
+    ksceIoClose(fd);
+    if (bytes <= 0)
+        return;
+    buf[bytes] = '\0';
+
+    _psvs_thermal_parse_config(buf);
+
+    // Sane thresholds, kept ordered, hysteresis still leaves a warm level
+    g_thermal_config.warm = _psvs_thermal_clamp(g_thermal_config.warm, PSVS_THERMAL_TEMP_MIN, PSVS_THERMAL_TEMP_MAX);
+    g_thermal_config.hot = _psvs_thermal_clamp(g_thermal_config.hot, g_thermal_config.warm, PSVS_THERMAL_TEMP_MAX);
+    g_thermal_config.hysteresis = _psvs_thermal_clamp(g_thermal_config.hysteresis, 1, g_thermal_config.warm - 1);
+}
@@ -0,0 +1,35 @@
+#ifndef _THERMAL_H_
+#define _THERMAL_H_
+
+#define PSVS_THERMAL_CONFIG "ur0:data/PSVshell_fork/thermal.txt"
+#define PSVS_THERMAL_LOG    "ur0:data/PSVshell_fork/thermal.log"
+
+#define PSVS_THERMAL_INTERVAL 1000 * 1000 // us
+
+// Defaults, in C, overridden by PSVS_THERMAL_CONFIG
+#define PSVS_THERMAL_WARM_DEFAULT 42
+#define PSVS_THERMAL_HOT_DEFAULT 46
+#define PSVS_THERMAL_HYSTERESIS_DEFAULT 3
+#define PSVS_THERMAL_TEMP_MIN 30 // config thresholds are clamped to this range
+#define PSVS_THERMAL_TEMP_MAX 60
+
+typedef enum {
+    PSVS_THERMAL_LEVEL_NORMAL,
+    PSVS_THERMAL_LEVEL_WARM, // no 500 MHz CPU
+    PSVS_THERMAL_LEVEL_HOT,  // everything capped near stock
+    PSVS_THERMAL_LEVEL_MAX
+} psvs_thermal_level_t;
+
+typedef struct {
+    int warm;       // C, level thresholds
+    int hot;
+    int hysteresis; // C below threshold to restore
+} psvs_thermal_config_t;
+
+void psvs_thermal_update();
+bool psvs_thermal_is_active();
+psvs_thermal_level_t psvs_thermal_get_level();
+
+void psvs_thermal_init();
+
+#endif
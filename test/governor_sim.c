@@ -0,0 +1,288 @@
+// Host simulation of the FPS-target governor against a synthetic game.
+//
+// The real perf.c, oc.c and governor.c run on a simulated clock: frames
+// are presented through psvs_perf_calc_fps() on 60Hz vsync, CPU idle time
+// goes through psvs_perf_poll_cpu(), clocks land in a fake ScePower.
+//
+//   governor_sim [-v]   -v prints one line per simulated second
+#include <vitasdkkern.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "oc.h"
+#include "perf.h"
+#include "governor.h"
+#include "stub.h"
+
+#define SECOND 1000000
+#define SIM_TICK (50 * 1000) // psvs_thread period
+#define SIM_VBLANK 16667
+
+static bool g_verbose = false;
+
+// Fake ScePower
+static int g_sim_freq[PSVS_OC_DEVICE_MAX];
+
+static int _sim_get_cpu() { return g_sim_freq[PSVS_OC_DEVICE_CPU]; }
+static int _sim_get_bus() { return g_sim_freq[PSVS_OC_DEVICE_BUS]; }
+static int _sim_get_xbar() { return g_sim_freq[PSVS_OC_DEVICE_GPU_XBAR]; }
+static int _sim_get_vnz() { return g_sim_freq[PSVS_OC_DEVICE_VENEZIA]; }
+static int _sim_get_es4(int *a1, int *a2) {
+    *a1 = *a2 = g_sim_freq[PSVS_OC_DEVICE_GPU_ES4];
+    return 0;
+}
+
+// Every clock change is kept to check the controller's moves
+#define SIM_EVENT_MAX 4096
+typedef struct {
+    SceUInt32 time;
+    psvs_oc_device_t device;
+    int from, to;
+} sim_event_t;
+
+static sim_event_t g_sim_events[SIM_EVENT_MAX];
+static int g_sim_event_n = 0;
+
+static int _sim_set(psvs_oc_device_t device, int freq) {
+    if (g_sim_freq[device] != freq && g_sim_event_n < SIM_EVENT_MAX) {
+        sim_event_t *event = &g_sim_events[g_sim_event_n++];
+        event->time = g_stub_time;
+        event->device = device;
+        event->from = g_sim_freq[device];
+        event->to = freq;
+    }
+    g_sim_freq[device] = freq;
+    return 0;
+}
+
+static int _sim_set_cpu(int freq) { return _sim_set(PSVS_OC_DEVICE_CPU, freq); }
+static int _sim_set_bus(int freq) { return _sim_set(PSVS_OC_DEVICE_BUS, freq); }
+static int _sim_set_xbar(int freq) { return _sim_set(PSVS_OC_DEVICE_GPU_XBAR, freq); }
+static int _sim_set_vnz(int freq) { return _sim_set(PSVS_OC_DEVICE_VENEZIA, freq); }
+static int _sim_set_es4(int a1, int a2) { return _sim_set(PSVS_OC_DEVICE_GPU_ES4, a1); }
+
+// Synthetic game: per-frame work at the highest clocks, in us.
+// CPU and GPU overlap, the slower one sets the frame length.
+typedef struct {
+    const char *name;
+    int cpu_work;
+    int gpu_work;
+    int target_fps;
+    int seconds;
+} sim_workload_t;
+
+static int _sim_cpu_time(const sim_workload_t *w) {
+    return (int64_t)w->cpu_work * 500 / g_sim_freq[PSVS_OC_DEVICE_CPU];
+}
+
+// ES4 does most of the work, BUS and XBAR feed it
+static int _sim_gpu_time(const sim_workload_t *w) {
+    int64_t scale = 70 * 222 * 1000 / g_sim_freq[PSVS_OC_DEVICE_GPU_ES4]
+                  + 20 * 222 * 1000 / g_sim_freq[PSVS_OC_DEVICE_BUS]
+                  + 10 * 166 * 1000 / g_sim_freq[PSVS_OC_DEVICE_GPU_XBAR];
+    return w->gpu_work * scale / (100 * 1000);
+}
+
+// Presented on the next vblank after both are done
+static int _sim_frametime(const sim_workload_t *w) {
+    int cpu = _sim_cpu_time(w);
+    int gpu = _sim_gpu_time(w);
+    int t = cpu > gpu ? cpu : gpu;
+    int vblanks = (t + SIM_VBLANK - 1) / SIM_VBLANK;
+    return (vblanks ? vblanks : 1) * SIM_VBLANK;
+}
+
+typedef struct {
+    int fps[600];          // presented frames per simulated second
+    int freq[PSVS_OC_DEVICE_MAX]; // at the end
+    int reverts;           // step downs undone the next decision
+    int cooldown_breaks;   // device stepped below a reverted step too soon
+} sim_result_t;
+
+static void _sim_run(const sim_workload_t *w, sim_result_t *result) {
+    static const int start_freq[PSVS_OC_DEVICE_MAX] = {333, 111, 222, 111, 166};
+    static uint8_t fb[2];
+
+    memset(result, 0, sizeof(sim_result_t));
+    memset(&g_stub_sysinfo, 0, sizeof(g_stub_sysinfo));
+    memcpy(g_sim_freq, start_freq, sizeof(g_sim_freq));
+    g_sim_event_n = 0;
+
+    // Fresh app, all devices governed, like picking "auto" in the menu
+    g_pid++;
+    g_stub_time = SECOND;
+    psvs_perf_init();
+    psvs_oc_init();
+    for (int i = 0; i < PSVS_OC_DEVICE_VENEZIA; i++)
+        psvs_oc_set_mode(i, PSVS_OC_MODE_GOVERNOR);
+    while (psvs_oc_get_target_fps() < w->target_fps)
+        psvs_oc_change_target_fps(true);
+    while (psvs_oc_get_target_fps() > w->target_fps)
+        psvs_oc_change_target_fps(false);
+    g_sim_event_n = 0; // setup is not the governor's doing
+
+    SceUInt32 start = g_stub_time;
+    SceUInt32 next_present = start;
+    uint32_t frame = 0;
+    for (int tick = 0; tick < w->seconds * (SECOND / SIM_TICK); tick++) {
+        SceUInt32 tick_end = g_stub_time + SIM_TICK;
+        int cpu_busy = 0;
+
+        while ((int32_t)(tick_end - next_present) >= 0) {
+            int frametime = _sim_frametime(w);
+            int cpu = _sim_cpu_time(w);
+            cpu_busy += cpu < frametime ? cpu : frametime;
+
+            g_stub_time = next_present;
+            g_stub_vcount = (next_present - start) / SIM_VBLANK;
+            psvs_perf_calc_fps(0, &fb[frame++ & 1]);
+            result->fps[(next_present - start) / SECOND]++;
+            next_present += frametime;
+        }
+
+        // Game thread on core 0, the rest idle
+        g_stub_time = tick_end;
+        if (cpu_busy > SIM_TICK)
+            cpu_busy = SIM_TICK;
+        g_stub_sysinfo.cpuInfo[0].idleClock += SIM_TICK - cpu_busy;
+        for (int i = 1; i < 4; i++)
+            g_stub_sysinfo.cpuInfo[i].idleClock += SIM_TICK;
+
+        psvs_perf_poll_cpu();
+        psvs_governor_update();
+
+        if (g_verbose && (tick + 1) % (SECOND / SIM_TICK) == 0) {
+            int s = (tick + 1) / (SECOND / SIM_TICK) - 1;
+            printf("  %3ds fps %2d load %3d%%  cpu %3d es4 %3d bus %3d xbar %3d\n", s, result->fps[s],
+                   psvs_perf_get_load(0), g_sim_freq[PSVS_OC_DEVICE_CPU], g_sim_freq[PSVS_OC_DEVICE_GPU_ES4],
+                   g_sim_freq[PSVS_OC_DEVICE_BUS], g_sim_freq[PSVS_OC_DEVICE_GPU_XBAR]);
+        }
+    }
+    memcpy(result->freq, g_sim_freq, sizeof(g_sim_freq));
+
+    // A step down raised again at the next decision is a reverted probe,
+    // it must not be tried again before the cooldown is over
+    for (int i = 0; i < g_sim_event_n; i++) {
+        const sim_event_t *down = &g_sim_events[i];
+        if (down->to >= down->from)
+            continue;
+
+        for (int j = i + 1; j < g_sim_event_n; j++) {
+            const sim_event_t *up = &g_sim_events[j];
+            if (up->time - down->time > PSVS_GOVERNOR_INTERVAL + SIM_TICK)
+                break;
+            if (up->device != down->device || up->from != down->to || up->to != down->from)
+                continue;
+
+            result->reverts++;
+            SceUInt32 blocked = (PSVS_GOVERNOR_COOLDOWN - 1) * PSVS_GOVERNOR_INTERVAL;
+            for (int k = j + 1; k < g_sim_event_n; k++) {
+                const sim_event_t *again = &g_sim_events[k];
+                if (again->time - up->time >= blocked)
+                    break;
+                if (again->device == down->device && again->to <= down->to)
+                    result->cooldown_breaks++;
+            }
+            break;
+        }
+    }
+}
+
+// Seconds at or above target in the last `seconds` of the run
+static int _sim_seconds_on_target(const sim_workload_t *w, const sim_result_t *result, int seconds) {
+    int n = 0;
+    for (int s = w->seconds - seconds; s < w->seconds; s++) {
+        if (result->fps[s] * 100 >= w->target_fps * 95)
+            n++;
+    }
+    return n;
+}
+
+static int g_failed = 0;
+
+#define SIM_CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            printf("  FAIL %s: ", #cond); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            g_failed++; \
+        } \
+    } while (0)
+
+static void _sim_report(const sim_workload_t *w, const sim_result_t *result) {
+    printf("%s: cpu %d es4 %d bus %d xbar %d, %d reverts, on target %d/30s\n", w->name,
+           result->freq[PSVS_OC_DEVICE_CPU], result->freq[PSVS_OC_DEVICE_GPU_ES4],
+           result->freq[PSVS_OC_DEVICE_BUS], result->freq[PSVS_OC_DEVICE_GPU_XBAR],
+           result->reverts, _sim_seconds_on_target(w, result, 30));
+}
+
+// GPU sets the pace, CPU has lots of slack and must come down
+static void _sim_gpu_bound() {
+    static const sim_workload_t w = {"gpu_bound", 6000, 16000, 30, 180};
+    static sim_result_t result;
+
+    if (g_verbose)
+        printf("%s\n", w.name);
+    _sim_run(&w, &result);
+    _sim_report(&w, &result);
+
+    SIM_CHECK(_sim_seconds_on_target(&w, &result, 30) >= 28, "target not held");
+    SIM_CHECK(result.freq[PSVS_OC_DEVICE_CPU] < 333, "cpu %d not lowered", result.freq[PSVS_OC_DEVICE_CPU]);
+    SIM_CHECK(result.freq[PSVS_OC_DEVICE_GPU_ES4] >= 111, "es4 %d starved", result.freq[PSVS_OC_DEVICE_GPU_ES4]);
+    SIM_CHECK(result.cooldown_breaks == 0, "%d reverted steps retried early", result.cooldown_breaks);
+}
+
+// Game thread needs 444 MHz to make 30 fps, starts at 333
+static void _sim_cpu_bound() {
+    static const sim_workload_t w = {"cpu_bound", 26000, 5000, 30, 180};
+    static sim_result_t result;
+
+    if (g_verbose)
+        printf("%s\n", w.name);
+    _sim_run(&w, &result);
+    _sim_report(&w, &result);
+
+    SIM_CHECK(_sim_seconds_on_target(&w, &result, 30) >= 28, "target not held");
+    SIM_CHECK(result.freq[PSVS_OC_DEVICE_CPU] >= 444, "cpu %d not raised", result.freq[PSVS_OC_DEVICE_CPU]);
+    SIM_CHECK(result.freq[PSVS_OC_DEVICE_GPU_ES4] < 222, "es4 %d not lowered", result.freq[PSVS_OC_DEVICE_GPU_ES4]);
+    SIM_CHECK(result.cooldown_breaks == 0, "%d reverted steps retried early", result.cooldown_breaks);
+}
+
+// Lowest workable clocks sit right at the edge, step downs past them
+// miss the target and have to be undone and held off
+static void _sim_probe_revert() {
+    static const sim_workload_t w = {"probe_revert", 9000, 14000, 30, 180};
+    static sim_result_t result;
+
+    if (g_verbose)
+        printf("%s\n", w.name);
+    _sim_run(&w, &result);
+    _sim_report(&w, &result);
+
+    SIM_CHECK(result.reverts > 0, "no probe was reverted");
+    SIM_CHECK(result.cooldown_breaks == 0, "%d reverted steps retried early", result.cooldown_breaks);
+    SIM_CHECK(_sim_seconds_on_target(&w, &result, 30) >= 27, "target not held");
+}
+
+int main(int argc, char **argv) {
+    g_verbose = argc > 1 && !strcmp(argv[1], "-v");
+
+    _kscePowerGetArmClockFrequency = _sim_get_cpu;
+    _kscePowerGetBusClockFrequency = _sim_get_bus;
+    _kscePowerGetGpuEs4ClockFrequency = _sim_get_es4;
+    _kscePowerGetGpuXbarClockFrequency = _sim_get_xbar;
+    _kscePowerGetVeneziaClockFrequencyForDriver = _sim_get_vnz;
+    _kscePowerSetArmClockFrequency = _sim_set_cpu;
+    _kscePowerSetBusClockFrequency = _sim_set_bus;
+    _kscePowerSetGpuEs4ClockFrequency = _sim_set_es4;
+    _kscePowerSetGpuXbarClockFrequency = _sim_set_xbar;
+    _kscePowerSetVeneziaClockFrequencyForDriver = _sim_set_vnz;
+
+    _sim_gpu_bound();
+    _sim_cpu_bound();
+    _sim_probe_revert();
+
+    return g_failed ? 1 : 0;
+}
@@ -0,0 +1,444 @@
+#include <vitasdkkern.h>
+#include <taihen.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "main.h"
+#include "stub.h"
+
+SceUInt32 g_stub_time = 0;
+int g_stub_vcount = 0;
+int g_stub_batt_temp = 3000;
+SceKernelSystemInfo g_stub_sysinfo;
+
+// Globals of main.c
+SceUID g_pid = INVALID_PID;
+psvs_app_t g_app = PSVS_APP_SCESHELL;
+char g_titleid[32] = "";
+bool g_is_dolce = false;
+
+static int _stub_get_sysinfo(SceKernelSystemInfo *info) {
+    memcpy(info, &g_stub_sysinfo, sizeof(SceKernelSystemInfo));
+    return 0;
+}
+
+static int _stub_pervasive(int mul, int ndiv) {
+    return 0;
+}
+
+static uint32_t g_stub_scepower[3];
+
+int (*SceSysmemForKernel_0x3650963F)(uint32_t a1, SceSysmemAddressSpaceInfo *a2) = NULL;
+int (*SceThreadmgrForDriver_0x7E280B69)(SceKernelSystemInfo *pInfo) = _stub_get_sysinfo;
+int (*ScePervasiveForDriver_0xE9D95643)(int mul, int ndiv) = _stub_pervasive;
+
+uint32_t *ScePower_41C8 = &g_stub_scepower[0];
+uint32_t *ScePower_41CC = &g_stub_scepower[1];
+uint32_t *ScePower_0    = &g_stub_scepower[2];
+
+// Clock backend is provided by the test that links oc.c
+int (*_kscePowerGetArmClockFrequency)();
+int (*_kscePowerGetBusClockFrequency)();
+int (*_kscePowerGetGpuEs4ClockFrequency)(int *a1, int *a2);
+int (*_kscePowerGetGpuXbarClockFrequency)();
+int (*_kscePowerGetVeneziaClockFrequencyForDriver)();
+
+int (*_kscePowerSetArmClockFrequency)(int freq);
+int (*_kscePowerSetBusClockFrequency)(int freq);
+int (*_kscePowerSetGpuEs4ClockFrequency)(int a1, int a2);
+int (*_kscePowerSetGpuXbarClockFrequency)(int freq);
+int (*_kscePowerSetVeneziaClockFrequencyForDriver)(int freq);
+
+SceUInt32 ksceKernelGetProcessTimeLowCore() {
+    return g_stub_time;
+}
+
+SceUInt32 ksceKernelSysrootGetCurrentAddressSpaceCB() {
+    return 0; // poll_memory is not host testable
+}
+
+#define STUB_OBJ_MAX 16
+#define STUB_ENOENT ((int)0x80010002)
+#define STUB_EEXIST ((int)0x80010011)
+#define STUB_EBADF  ((int)0x80010009)
+#define STUB_ENOMEM ((int)0x8001000C)
+
+// Worker threads of the tested sources run as pthreads
+typedef struct {
+    bool used;
+    pthread_mutex_t mutex;
+} stub_mutex_t;
+
+typedef struct {
+    bool used;
+    unsigned int bits;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} stub_evf_t;
+
+typedef struct {
+    bool used;
+    bool started;
+    SceKernelThreadEntry entry;
+    SceSize arglen;
+    void *argp;
+    pthread_t thread;
+} stub_thread_t;
+
+static stub_mutex_t g_stub_mutexes[STUB_OBJ_MAX];
+static stub_evf_t g_stub_evfs[STUB_OBJ_MAX];
+static stub_thread_t g_stub_threads[STUB_OBJ_MAX];
+
+SceUID ksceKernelCreateMutex(const char *name, SceUInt32 attr, int count, void *opt) {
+    for (int i = 0; i < STUB_OBJ_MAX; i++) {
+        if (!g_stub_mutexes[i].used) {
+            g_stub_mutexes[i].used = true;
+            pthread_mutex_init(&g_stub_mutexes[i].mutex, NULL);
+            return i + 1;
+        }
+    }
+    return STUB_ENOMEM;
+}
+
+int ksceKernelLockMutex(SceUID mutexid, int count, unsigned int *timeout) {
+    return pthread_mutex_lock(&g_stub_mutexes[mutexid - 1].mutex);
+}
+
+int ksceKernelUnlockMutex(SceUID mutexid, int count) {
+    return pthread_mutex_unlock(&g_stub_mutexes[mutexid - 1].mutex);
+}
+
+int ksceKernelDeleteMutex(SceUID mutexid) {
+    pthread_mutex_destroy(&g_stub_mutexes[mutexid - 1].mutex);
+    g_stub_mutexes[mutexid - 1].used = false;
+    return 0;
+}
+
+SceUID ksceKernelCreateEventFlag(const char *name, int attr, int bits, void *opt) {
+    for (int i = 0; i < STUB_OBJ_MAX; i++) {
+        stub_evf_t *evf = &g_stub_evfs[i];
+        if (!evf->used) {
+            evf->used = true;
+            evf->bits = bits;
+            pthread_mutex_init(&evf->lock, NULL);
+            pthread_cond_init(&evf->cond, NULL);
+            return i + 1;
+        }
+    }
+    return STUB_ENOMEM;
+}
+
+int ksceKernelSetEventFlag(SceUID evfid, unsigned int bits) {
+    stub_evf_t *evf = &g_stub_evfs[evfid - 1];
+    pthread_mutex_lock(&evf->lock);
+    evf->bits |= bits;
+    pthread_cond_broadcast(&evf->cond);
+    pthread_mutex_unlock(&evf->lock);
+    return 0;
+}
+
+int ksceKernelWaitEventFlag(SceUID evfid, unsigned int bits, unsigned int wait,
+                            unsigned int *outBits, SceUInt32 *timeout) {
+    stub_evf_t *evf = &g_stub_evfs[evfid - 1];
+    pthread_mutex_lock(&evf->lock);
+    while ((wait & SCE_KERNEL_EVF_WAITMODE_OR) ? !(evf->bits & bits) : (evf->bits & bits) != bits)
+        pthread_cond_wait(&evf->cond, &evf->lock);
+    if (outBits)
+        *outBits = evf->bits;
+    if (wait & SCE_KERNEL_EVF_WAITMODE_CLEAR_ALL)
+        evf->bits = 0;
+    pthread_mutex_unlock(&evf->lock);
+    return 0;
+}
+
+int ksceKernelDeleteEventFlag(SceUID evfid) {
+    stub_evf_t *evf = &g_stub_evfs[evfid - 1];
+    pthread_cond_destroy(&evf->cond);
+    pthread_mutex_destroy(&evf->lock);
+    evf->used = false;
+    return 0;
+}
+
+static void *_stub_thread_entry(void *arg) {
+    stub_thread_t *thread = arg;
+    thread->entry(thread->arglen, thread->argp);
+    return NULL;
+}
+
+SceUID ksceKernelCreateThread(const char *name, SceKernelThreadEntry entry, int initPriority,
+                              int stackSize, SceUInt32 attr, int cpuAffinityMask, void *option) {
+    for (int i = 0; i < STUB_OBJ_MAX; i++) {
+        stub_thread_t *thread = &g_stub_threads[i];
+        if (!thread->used) {
+            memset(thread, 0, sizeof(stub_thread_t));
+            thread->used = true;
+            thread->entry = entry;
+            return i + 1;
+        }
+    }
+    return STUB_ENOMEM;
+}
+
+int ksceKernelStartThread(SceUID thid, SceSize arglen, void *argp) {
+    stub_thread_t *thread = &g_stub_threads[thid - 1];
+    thread->arglen = arglen;
+    thread->argp = argp;
+    thread->started = !pthread_create(&thread->thread, NULL, _stub_thread_entry, thread);
+    return thread->started ? 0 : STUB_ENOMEM;
+}
+
+int ksceKernelWaitThreadEnd(SceUID thid, int *stat, SceUInt32 *timeout) {
+    stub_thread_t *thread = &g_stub_threads[thid - 1];
+    if (thread->started)
+        pthread_join(thread->thread, NULL);
+    thread->started = false;
+    return 0;
+}
+
+int ksceKernelDeleteThread(SceUID thid) {
+    g_stub_threads[thid - 1].used = false;
+    return 0;
+}
+
+int ksceKernelDelayThread(SceUInt32 delay) {
+    return usleep(delay);
+}
+
+// In-memory filesystem, flat, directories are path prefixes
+#define STUB_FILE_MAX 300
+#define STUB_PATH_MAX 128
+
+typedef struct {
+    bool used;
+    char path[STUB_PATH_MAX];
+    uint8_t *data;
+    int size;
+} stub_file_t;
+
+typedef struct {
+    bool used;
+    int file;
+    int pos;
+    int flags;
+} stub_fd_t;
+
+typedef struct {
+    bool used;
+    char path[STUB_PATH_MAX];
+    int next; // file index
+} stub_dir_t;
+
+static stub_file_t g_stub_files[STUB_FILE_MAX];
+static stub_fd_t g_stub_fds[STUB_OBJ_MAX];
+static stub_dir_t g_stub_dirs[STUB_OBJ_MAX];
+
+static int _stub_fs_find(const char *path) {
+    for (int i = 0; i < STUB_FILE_MAX; i++) {
+        if (g_stub_files[i].used && !strcmp(g_stub_files[i].path, path))
+            return i;
+    }
+    return -1;
+}
+
+static int _stub_fs_create(const char *path) {
+    for (int i = 0; i < STUB_FILE_MAX; i++) {
+        stub_file_t *file = &g_stub_files[i];
+        if (!file->used) {
+            memset(file, 0, sizeof(stub_file_t));
+            file->used = true;
+            strncpy(file->path, path, STUB_PATH_MAX - 1);
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void _stub_fs_free(int i) {
+    free(g_stub_files[i].data);
+    memset(&g_stub_files[i], 0, sizeof(stub_file_t));
+}
+
+void stub_fs_reset() {
+    for (int i = 0; i < STUB_FILE_MAX; i++)
+        _stub_fs_free(i);
+}
+
+bool stub_fs_put(const char *path, const void *data, int size) {
+    int i = _stub_fs_find(path);
+    if (i >= 0)
+        _stub_fs_free(i);
+    i = _stub_fs_create(path);
+    if (i < 0)
+        return false;
+
+    g_stub_files[i].data = malloc(size ? size : 1);
+    memcpy(g_stub_files[i].data, data, size);
+    g_stub_files[i].size = size;
+    return true;
+}
+
+int stub_fs_get(const char *path, void *data, int size) {
+    int i = _stub_fs_find(path);
+    if (i < 0)
+        return -1;
+    if (data)
+        memcpy(data, g_stub_files[i].data, size < g_stub_files[i].size ? size : g_stub_files[i].size);
+    return g_stub_files[i].size;
+}
+
+SceUID ksceIoOpen(const char *file, int flags, SceMode mode) {
+    int i = _stub_fs_find(file);
+    if (i < 0 && !(flags & SCE_O_CREAT))
+        return STUB_ENOENT;
+    if (i < 0 && (i = _stub_fs_create(file)) < 0)
+        return STUB_ENOMEM;
+    if (flags & SCE_O_TRUNC)
+        g_stub_files[i].size = 0;
+
+    for (int fd = 0; fd < STUB_OBJ_MAX; fd++) {
+        if (!g_stub_fds[fd].used) {
+            g_stub_fds[fd].used = true;
+            g_stub_fds[fd].file = i;
+            g_stub_fds[fd].pos = 0;
+            g_stub_fds[fd].flags = flags;
+            return fd + 1;
+        }
+    }
+    return STUB_ENOMEM;
+}
+
+int ksceIoClose(SceUID fd) {
+    if (fd < 1 || fd > STUB_OBJ_MAX || !g_stub_fds[fd - 1].used)
+        return STUB_EBADF;
+    g_stub_fds[fd - 1].used = false;
+    return 0;
+}
+
+int ksceIoRead(SceUID fd, void *data, SceSize size) {
+    stub_fd_t *f = &g_stub_fds[fd - 1];
+    stub_file_t *file = &g_stub_files[f->file];
+    int n = file->size - f->pos;
+    if (n > (int)size)
+        n = size;
+    if (n <= 0)
+        return 0;
+
+    memcpy(data, file->data + f->pos, n);
+    f->pos += n;
+    return n;
+}
+
+int ksceIoWrite(SceUID fd, const void *data, SceSize size) {
+    stub_fd_t *f = &g_stub_fds[fd - 1];
+    stub_file_t *file = &g_stub_files[f->file];
+    if (f->flags & SCE_O_APPEND)
+        f->pos = file->size;
+    if (f->pos + (int)size > file->size) {
+        file->data = realloc(file->data, f->pos + size);
+        file->size = f->pos + size;
+    }
+
+    memcpy(file->data + f->pos, data, size);
+    f->pos += size;
+    return size;
+}
+
+int ksceIoRemove(const char *file) {
+    int i = _stub_fs_find(file);
+    if (i < 0)
+        return STUB_ENOENT;
+    _stub_fs_free(i);
+    return 0;
+}
+
+int ksceIoRename(const char *oldname, const char *newname) {
+    int i = _stub_fs_find(oldname);
+    if (i < 0)
+        return STUB_ENOENT;
+    if (_stub_fs_find(newname) >= 0)
+        return STUB_EEXIST;
+
+    memset(g_stub_files[i].path, 0, STUB_PATH_MAX);
+    strncpy(g_stub_files[i].path, newname, STUB_PATH_MAX - 1);
+    return 0;
+}
+
+int ksceIoGetstat(const char *file, SceIoStat *stat) {
+    int i = _stub_fs_find(file);
+    if (i < 0)
+        return STUB_ENOENT;
+
+    memset(stat, 0, sizeof(SceIoStat));
+    stat->st_mode = SCE_S_IFREG;
+    stat->st_size = g_stub_files[i].size;
+    return 0;
+}
+
+int ksceIoMkdir(const char *dir, SceMode mode) {
+    return 0;
+}
+
+SceUID ksceIoDopen(const char *dirname) {
+    for (int fd = 0; fd < STUB_OBJ_MAX; fd++) {
+        stub_dir_t *dir = &g_stub_dirs[fd];
+        if (!dir->used) {
+            dir->used = true;
+            dir->next = 0;
+            memset(dir->path, 0, STUB_PATH_MAX);
+            strncpy(dir->path, dirname, STUB_PATH_MAX - 1);
+            return fd + 1;
+        }
+    }
+    return STUB_ENOMEM;
+}
+
+// Files right under the dir, no subdirectories
+int ksceIoDread(SceUID fd, SceIoDirent *dirent) {
+    stub_dir_t *dir = &g_stub_dirs[fd - 1];
+    int len = strlen(dir->path);
+    for (; dir->next < STUB_FILE_MAX; dir->next++) {
+        stub_file_t *file = &g_stub_files[dir->next];
+        if (!file->used || strncmp(file->path, dir->path, len) || strchr(file->path + len, '/'))
+            continue;
+
+        memset(dirent, 0, sizeof(SceIoDirent));
+        dirent->d_stat.st_mode = SCE_S_IFREG;
+        dirent->d_stat.st_size = file->size;
+        strncpy(dirent->d_name, file->path + len, sizeof(dirent->d_name) - 1);
+        dir->next++;
+        return 1;
+    }
+    return 0;
+}
+
+int ksceIoDclose(SceUID fd) {
+    g_stub_dirs[fd - 1].used = false;
+    return 0;
+}
+
+int ksceKernelGetProcessLocalStorageAddrForPid(SceUID pid, int key, void **addr, int create) {
+    return -1; // app default clocks come from devopt
+}
+
+int ksceDisplayGetVcount(void) {
+    return g_stub_vcount;
+}
+
+int kscePowerGetBatteryLifePercent(void) {
+    return 100;
+}
+
+int kscePowerGetBatteryTemp(void) {
+    return g_stub_batt_temp;
+}
+
+int kscePowerGetBatteryLifeTime(void) {
+    return 300;
+}
+
+int kscePowerIsBatteryCharging(void) {
+    return 0;
+}
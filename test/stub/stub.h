@@ -0,0 +1,17 @@
+#ifndef _STUB_H_
+#define _STUB_H_
+
+// Kernel state seen by the tested sources, set by the test
+extern SceUInt32 g_stub_time;   // ksceKernelGetProcessTimeLowCore(), us
+extern int g_stub_vcount;       // ksceDisplayGetVcount()
+extern int g_stub_batt_temp;    // kscePowerGetBatteryTemp(), 1/100 C
+extern SceKernelSystemInfo g_stub_sysinfo; // SceThreadmgrForDriver_0x7E280B69()
+
+SceUInt32 ksceKernelGetProcessTimeLowCore();
+
+// In-memory filesystem behind ksceIo*()
+void stub_fs_reset();
+bool stub_fs_put(const char *path, const void *data, int size);
+int stub_fs_get(const char *path, void *data, int size); // file size, -1 if missing
+
+#endif
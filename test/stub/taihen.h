@@ -0,0 +1,9 @@
+// Host stand-in for taihen.h, hooks are never installed in host tests
+#ifndef _STUB_TAIHEN_H_
+#define _STUB_TAIHEN_H_
+
+#include <stdint.h>
+
+typedef uintptr_t tai_hook_ref_t;
+
+#endif
@@ -0,0 +1,111 @@
+// Host stand-in for the VitaSDK kernel headers, only what the tested
+// sources use. Behaviour is driven by test/stub/stub.h.
+#ifndef _STUB_VITASDKKERN_H_
+#define _STUB_VITASDKKERN_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef int SceUID;
+typedef int SceMode;
+typedef unsigned int SceSize;
+typedef unsigned int SceUInt32;
+typedef uint64_t SceKernelSysClock;
+typedef int64_t SceOff;
+
+typedef struct SceDisplayFrameBuf {
+    SceSize size;
+    void *base;
+    unsigned int pitch;
+    unsigned int pixelformat;
+    unsigned int width;
+    unsigned int height;
+} SceDisplayFrameBuf;
+
+typedef struct SceCtrlData {
+    uint64_t timeStamp;
+    unsigned int buttons;
+    uint8_t lx, ly, rx, ry;
+    uint8_t reserved[16];
+} SceCtrlData;
+
+typedef struct SceIoStat {
+    SceMode st_mode;
+    unsigned int st_attr;
+    SceOff st_size;
+} SceIoStat;
+
+#define SCE_S_IFDIR 0x1000
+#define SCE_S_IFREG 0x2000
+#define SCE_S_ISREG(m) (((m) & 0xF000) == SCE_S_IFREG)
+
+typedef struct SceIoDirent {
+    SceIoStat d_stat;
+    char d_name[256];
+    void *d_private;
+    int dummy;
+} SceIoDirent;
+
+typedef struct SceDateTime {
+    unsigned short year, month, day, hour, minute, second;
+    unsigned int microsecond;
+} SceDateTime;
+
+#define SCE_O_RDONLY 0x0001
+#define SCE_O_WRONLY 0x0002
+#define SCE_O_RDWR   0x0003
+#define SCE_O_APPEND 0x0100
+#define SCE_O_CREAT  0x0200
+#define SCE_O_TRUNC  0x0400
+#define SCE_SEEK_SET 0
+#define SCE_SEEK_END 2
+
+#define SCE_KERNEL_EVF_WAITMODE_AND       0x00000000
+#define SCE_KERNEL_EVF_WAITMODE_OR        0x00000001
+#define SCE_KERNEL_EVF_WAITMODE_CLEAR_ALL 0x00000002
+
+#define ENTER_SYSCALL(state) do { (state) = 0; } while (0)
+#define EXIT_SYSCALL(state) do { (void)(state); } while (0)
+
+SceUID ksceKernelCreateMutex(const char *name, SceUInt32 attr, int count, void *opt);
+int ksceKernelLockMutex(SceUID mutexid, int count, unsigned int *timeout);
+int ksceKernelUnlockMutex(SceUID mutexid, int count);
+int ksceKernelDeleteMutex(SceUID mutexid);
+
+typedef int (*SceKernelThreadEntry)(SceSize args, void *argp);
+
+SceUID ksceKernelCreateThread(const char *name, SceKernelThreadEntry entry, int initPriority,
+                              int stackSize, SceUInt32 attr, int cpuAffinityMask, void *option);
+int ksceKernelStartThread(SceUID thid, SceSize arglen, void *argp);
+int ksceKernelWaitThreadEnd(SceUID thid, int *stat, SceUInt32 *timeout);
+int ksceKernelDeleteThread(SceUID thid);
+int ksceKernelDelayThread(SceUInt32 delay);
+
+SceUID ksceKernelCreateEventFlag(const char *name, int attr, int bits, void *opt);
+int ksceKernelSetEventFlag(SceUID evfid, unsigned int bits);
+int ksceKernelWaitEventFlag(SceUID evfid, unsigned int bits, unsigned int wait,
+                            unsigned int *outBits, SceUInt32 *timeout);
+int ksceKernelDeleteEventFlag(SceUID evfid);
+
+SceUID ksceIoOpen(const char *file, int flags, SceMode mode);
+int ksceIoClose(SceUID fd);
+int ksceIoRead(SceUID fd, void *data, SceSize size);
+int ksceIoWrite(SceUID fd, const void *data, SceSize size);
+int ksceIoRemove(const char *file);
+int ksceIoRename(const char *oldname, const char *newname);
+int ksceIoGetstat(const char *file, SceIoStat *stat);
+int ksceIoMkdir(const char *dir, SceMode mode);
+SceUID ksceIoDopen(const char *dirname);
+int ksceIoDread(SceUID fd, SceIoDirent *dir);
+int ksceIoDclose(SceUID fd);
+
+int ksceKernelGetProcessLocalStorageAddrForPid(SceUID pid, int key, void **addr, int create);
+int ksceDisplayGetVcount(void);
+
+int kscePowerGetBatteryLifePercent(void);
+int kscePowerGetBatteryTemp(void);
+int kscePowerGetBatteryLifeTime(void);
+int kscePowerIsBatteryCharging(void);
+
+#endif
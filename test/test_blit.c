@@ -0,0 +1,373 @@
+// Host unit tests of blit.c against plain references: alpha blend,
+// per pixelformat ops, palette expand and glyph atlas kernels, plus the
+// generated gui_layout.h tables against the float math they replace.
+//
+// Built for ARM with NEON (e.g. run under qemu-arm), psvs_blit_blend_row()
+// is the NEON kernel and gets checked against the scalar reference too.
+//
+//   test_blit [-b]   -b also times text rendering, glyphs per second
+#include <vitasdkkern.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gui.h"
+#include "gui_font.h"
+#include "gui_layout.h"
+#include "blit.h"
+
+static int g_failed = 0;
+
+#define TEST_CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            printf("  FAIL %s:%d %s: ", __func__, __LINE__, #cond); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            g_failed++; \
+        } \
+    } while (0)
+
+static uint32_t g_seed = 1;
+
+static uint32_t _test_rand() {
+    g_seed = g_seed * 1103515245 + 12345;
+    return g_seed >> 8;
+}
+
+// (s * a + d * (255 - a)) / 255, rounded to nearest (255 is odd, no ties)
+static uint8_t _test_blend_ch(int s, int d, int a) {
+    return (2 * (s * a + d * (255 - a)) + 255) / 510;
+}
+
+static void test_blend() {
+    // Every channel value and alpha
+    rgba_t dst[256], src[256];
+    for (int s = 0; s < 256; s++) {
+        for (int d = 0; d < 256; d++) {
+            for (int a = 0; a < 256; a++) {
+                src[a].uint32 = 0;
+                src[a].rgba.r = s;
+                src[a].rgba.g = d;
+                src[a].rgba.b = 255 - s;
+                src[a].rgba.a = a;
+                dst[a].uint32 = 0;
+                dst[a].rgba.r = d;
+                dst[a].rgba.g = s;
+                dst[a].rgba.b = 255 - d;
+                dst[a].rgba.a = 0x5A;
+            }
+
+            psvs_blit_blend_row_ref(dst, src, 256);
+            for (int a = 0; a < 256; a++) {
+                if (dst[a].rgba.r != _test_blend_ch(s, d, a) || dst[a].rgba.g != _test_blend_ch(d, s, a)
+                        || dst[a].rgba.b != _test_blend_ch(255 - s, 255 - d, a) || dst[a].rgba.a != 0x5A) {
+                    TEST_CHECK(false, "s %d d %d a %d: %08X", s, d, a, dst[a].uint32);
+                    return;
+                }
+            }
+        }
+    }
+
+    // Fast path is bit-exact with the reference, at any length and offset
+    for (int n = 0; n <= 67; n++) {
+        for (int off = 0; off < 4; off++) {
+            rgba_t s[80], d[80], d_ref[80];
+            for (int i = 0; i < 80; i++) {
+                s[i].uint32 = _test_rand() ^ (_test_rand() << 16);
+                d[i].uint32 = d_ref[i].uint32 = _test_rand() ^ (_test_rand() << 16);
+            }
+            psvs_blit_blend_row(&d[off], &s[off], n);
+            psvs_blit_blend_row_ref(&d_ref[off], &s[off], n);
+            TEST_CHECK(!memcmp(d, d_ref, sizeof(d)), "n %d off %d differs from reference", n, off);
+        }
+    }
+}
+
+static void test_expand() {
+    uint32_t palette[256];
+    uint8_t src[75];
+    uint32_t dst[80];
+
+    for (int i = 0; i < 256; i++)
+        palette[i] = _test_rand();
+    for (int i = 0; i < sizeof(src); i++)
+        src[i] = _test_rand();
+
+    for (int n = 0; n <= sizeof(src); n++) {
+        memset(dst, 0xCD, sizeof(dst));
+        psvs_blit_expand_row(dst, src, palette, n);
+        for (int i = 0; i < n; i++)
+            TEST_CHECK(dst[i] == palette[src[i]], "n %d px %d", n, i);
+        TEST_CHECK(dst[n] == 0xCDCDCDCD, "n %d wrote past end", n);
+    }
+}
+
+// A2B10G10R10 reference, 8-bit channels are the top bits of the 10-bit ones
+static uint32_t _test_pack_A2B10G10R10(rgba_t c) {
+    uint32_t r = (c.rgba.r * 1023 + 127) / 255;
+    uint32_t g = (c.rgba.g * 1023 + 127) / 255;
+    uint32_t b = (c.rgba.b * 1023 + 127) / 255;
+    return ((uint32_t)(c.rgba.a >> 6) << 30) | (b << 20) | (g << 10) | r;
+}
+
+static rgba_t _test_unpack_A2B10G10R10(uint32_t px) {
+    rgba_t c;
+    c.rgba.r = (px & 0x3FF) >> 2;
+    c.rgba.g = ((px >> 10) & 0x3FF) >> 2;
+    c.rgba.b = ((px >> 20) & 0x3FF) >> 2;
+    c.rgba.a = (px >> 30) * 255 / 3;
+    return c;
+}
+
+static int _test_diff_10(uint32_t a, uint32_t b, int shift) {
+    return abs((int)((a >> shift) & 0x3FF) - (int)((b >> shift) & 0x3FF));
+}
+
+static void test_ops() {
+    TEST_CHECK(psvs_blit_get_ops(0x12345678) == NULL, "unsupported format has ops");
+
+    // Native, px is rgba_t
+    const psvs_blit_ops_t *ops = psvs_blit_get_ops(PSVS_BLIT_PIXELFORMAT_A8B8G8R8);
+    TEST_CHECK(ops && ops->pixelformat == PSVS_BLIT_PIXELFORMAT_A8B8G8R8, "A8B8G8R8 missing");
+    if (ops) {
+        rgba_t c = {.rgba = {.r = 1, .g = 2, .b = 3, .a = 4}};
+        TEST_CHECK(ops->pack(c) == 0x04030201, "A8B8G8R8 pack %08X", ops->pack(c));
+
+        rgba_t src[37];
+        uint32_t dst[37], ref[37];
+        for (int i = 0; i < 37; i++) {
+            src[i].uint32 = _test_rand() ^ (_test_rand() << 16);
+            dst[i] = ref[i] = _test_rand() ^ (_test_rand() << 16);
+        }
+        ops->blend_row(dst, src, 37);
+        for (int i = 0; i < 37; i++) {
+            rgba_t d = {.uint32 = ref[i]};
+            d.rgba.r = _test_blend_ch(src[i].rgba.r, d.rgba.r, src[i].rgba.a);
+            d.rgba.g = _test_blend_ch(src[i].rgba.g, d.rgba.g, src[i].rgba.a);
+            d.rgba.b = _test_blend_ch(src[i].rgba.b, d.rgba.b, src[i].rgba.a);
+            TEST_CHECK(dst[i] == d.uint32, "A8B8G8R8 blend px %d: %08X, expected %08X", i, dst[i], d.uint32);
+        }
+    }
+
+    // 10-bit, widened to within 1 LSB, 8 bits survive a round trip
+    ops = psvs_blit_get_ops(PSVS_BLIT_PIXELFORMAT_A2B10G10R10);
+    TEST_CHECK(ops && ops->pixelformat == PSVS_BLIT_PIXELFORMAT_A2B10G10R10, "A2B10G10R10 missing");
+    if (ops) {
+        for (int v = 0; v < 256; v++) {
+            rgba_t c = {.rgba = {.r = v, .g = 255 - v, .b = v ^ 0x55, .a = v}};
+            uint32_t px = ops->pack(c);
+            uint32_t ref = _test_pack_A2B10G10R10(c);
+            TEST_CHECK(_test_diff_10(px, ref, 0) <= 1 && _test_diff_10(px, ref, 10) <= 1
+                       && _test_diff_10(px, ref, 20) <= 1 && (px >> 30) == (ref >> 30),
+                       "A2B10G10R10 pack %d: %08X, expected ~%08X", v, px, ref);
+
+            rgba_t back = _test_unpack_A2B10G10R10(px);
+            TEST_CHECK(back.rgba.r == c.rgba.r && back.rgba.g == c.rgba.g && back.rgba.b == c.rgba.b,
+                       "A2B10G10R10 round trip %d: %08X", v, back.uint32);
+        }
+
+        rgba_t src[37];
+        uint32_t dst[37], ref[37];
+        for (int i = 0; i < 37; i++) {
+            src[i].uint32 = _test_rand() ^ (_test_rand() << 16);
+            dst[i] = ref[i] = _test_rand() ^ (_test_rand() << 16);
+        }
+        ops->blend_row(dst, src, 37);
+        for (int i = 0; i < 37; i++) {
+            rgba_t d = _test_unpack_A2B10G10R10(ref[i]);
+            d.rgba.r = _test_blend_ch(src[i].rgba.r, d.rgba.r, src[i].rgba.a);
+            d.rgba.g = _test_blend_ch(src[i].rgba.g, d.rgba.g, src[i].rgba.a);
+            d.rgba.b = _test_blend_ch(src[i].rgba.b, d.rgba.b, src[i].rgba.a);
+            rgba_t got = _test_unpack_A2B10G10R10(dst[i]);
+            got.rgba.a = d.rgba.a;
+            TEST_CHECK(got.uint32 == d.uint32 && (dst[i] >> 30) == (ref[i] >> 30),
+                       "A2B10G10R10 blend px %d: %08X, expected %08X", i, dst[i], ops->pack(d));
+        }
+    }
+}
+
+static const psvs_gui_font_t *g_test_fonts[] = {&FONT_TER_U14B, &FONT_TER_U18B, &FONT_TER_U24B};
+#define TEST_FONTS_N (sizeof(g_test_fonts) / sizeof(g_test_fonts[0]))
+
+// Glyph px as the renderer sampled it before the atlas, float scale per px
+static bool _test_glyph_px(const psvs_gui_font_t *font, int glyph, float scale, int xx, int yy) {
+    int xx_font = xx / scale;
+    int yy_font = yy / scale;
+    return (font->rows[glyph * font->height + yy_font] >> xx_font) & 1;
+}
+
+static void test_glyph_half() {
+    for (int f = 0; f < TEST_FONTS_N; f++) {
+        const psvs_gui_font_t *font = g_test_fonts[f];
+        int w = 0, h = 0;
+
+        for (int c = 0; c < GUI_FONT_GLYPHS; c++) {
+            uint16_t half[(GUI_FONT_H + 1) / 2 + 1];
+            half[(font->height + 1) / 2] = 0xBEEF;
+            psvs_blit_glyph_half(half, &font->rows[c * font->height], font->width, font->height);
+            TEST_CHECK(half[(font->height + 1) / 2] == 0xBEEF, "font %d glyph %d wrote past end", f, c);
+
+            // Same px the 0.5x float renderer drew
+            for (h = 0; h < font->height * 0.5f; h++) {
+                for (w = 0; w < font->width * 0.5f; w++) {
+                    bool px = (half[h] >> w) & 1;
+                    if (px != _test_glyph_px(font, c, 0.5f, w, h)) {
+                        TEST_CHECK(false, "font %d glyph %d px %d,%d", f, c, w, h);
+                        break;
+                    }
+                }
+                TEST_CHECK(!(half[h] >> w), "font %d glyph %d row %d wider than glyph", f, c, h);
+            }
+        }
+        TEST_CHECK(w == (font->width + 1) >> 1 && h == (font->height + 1) >> 1,
+                   "font %d half size %dx%d", f, w, h);
+    }
+}
+
+static void test_glyph_spans() {
+    for (int f = 0; f < TEST_FONTS_N; f++) {
+        const psvs_gui_font_t *font = g_test_fonts[f];
+        int max = font->height * ((font->width + 1) / 2);
+
+        for (int c = 0; c < GUI_FONT_GLYPHS; c++) {
+            psvs_blit_span_t spans[GUI_FONT_H * ((GUI_FONT_W + 1) / 2)];
+            const uint16_t *rows = &font->rows[c * font->height];
+            int n = psvs_blit_glyph_spans(spans, rows, font->width, font->height);
+            TEST_CHECK(n <= max, "font %d glyph %d: %d spans", f, c, n);
+
+            // Drawn spans cover exactly the set px, without overlap
+            uint16_t drawn[GUI_FONT_H] = {0};
+            for (int i = 0; i < n; i++) {
+                uint16_t mask = ((1 << spans[i].len) - 1) << spans[i].x;
+                TEST_CHECK(spans[i].len > 0 && !(drawn[spans[i].y] & mask), "font %d glyph %d span %d", f, c, i);
+                drawn[spans[i].y] |= mask;
+            }
+            for (int yy = 0; yy < font->height; yy++) {
+                uint16_t row = rows[yy] & ((1 << font->width) - 1);
+                TEST_CHECK(drawn[yy] == row, "font %d glyph %d row %d: %04X, expected %04X", f, c, yy, drawn[yy], row);
+            }
+        }
+    }
+
+    // Alternating px is the worst case
+    uint16_t rows[GUI_FONT_H];
+    psvs_blit_span_t spans[GUI_FONT_H * ((GUI_FONT_W + 1) / 2)];
+    for (int yy = 0; yy < GUI_FONT_H; yy++)
+        rows[yy] = 0x5555;
+    int n = psvs_blit_glyph_spans(spans, rows, GUI_FONT_W, GUI_FONT_H);
+    TEST_CHECK(n == GUI_FONT_H * ((GUI_FONT_W + 1) / 2), "%d spans", n);
+}
+
+static void test_remap() {
+    for (int c = 0; c < 256; c++) {
+        int glyph = GUI_FONT_REMAP[c];
+        TEST_CHECK(glyph < GUI_FONT_GLYPHS, "char %d -> glyph %d", c, glyph);
+        if (c >= ' ' && c <= '~')
+            TEST_CHECK(glyph == c - ' ', "char %c -> glyph %d", c, glyph);
+    }
+}
+
+static int _test_rescale(int v, float ratio) {
+    return (int)(v * (ratio > 1.0f ? 1.0f : ratio));
+}
+
+static void test_layout() {
+    for (int i = 0; i < GUI_LAYOUTS_N; i++) {
+        const psvs_gui_layout_t *layout = &GUI_LAYOUTS[i];
+        float ratio_w = layout->width / 960.0f;
+        float ratio_h = layout->height / 544.0f;
+
+        TEST_CHECK(i == 0 || layout->width > GUI_LAYOUTS[i - 1].width, "layout %d not sorted", i);
+        TEST_CHECK(layout->font->height <= GUI_FONT_H && layout->font->width <= GUI_FONT_W, "layout %d font", i);
+
+        for (int x = 0; x <= GUI_WIDTH; x++)
+            TEST_CHECK(layout->rescale_x[x] == _test_rescale(x, ratio_w), "layout %d x %d: %d", i, x, layout->rescale_x[x]);
+        for (int y = 0; y <= GUI_HEIGHT; y++)
+            TEST_CHECK(layout->rescale_y[y] == _test_rescale(y, ratio_h), "layout %d y %d: %d", i, y, layout->rescale_y[y]);
+
+        TEST_CHECK(layout->full_w == layout->rescale_x[GUI_WIDTH] && layout->full_h == layout->rescale_y[GUI_HEIGHT]
+                   && layout->full_w <= layout->width && layout->full_h <= layout->height, "layout %d full size", i);
+        TEST_CHECK(layout->osd_w == layout->full_w && layout->osd_h == _test_rescale(GUI_OSD_HEIGHT, ratio_h),
+                   "layout %d osd size", i);
+
+        // Rounded corners only clip the first and last rows
+        for (int y = 0; y < layout->full_h; y++)
+            TEST_CHECK(layout->full_xd[y] < layout->full_w / 2, "layout %d row %d clip %d", i, y, layout->full_xd[y]);
+        TEST_CHECK(layout->full_xd[0] > 0 && layout->full_xd[layout->full_h / 2] == 0, "layout %d corners", i);
+        TEST_CHECK(layout->osd_xd[0] > 0 && layout->osd_xd[layout->osd_h / 2] == 0, "layout %d osd corners", i);
+    }
+}
+
+// Glyphs per second, renderer before the atlas vs row masks
+#define BENCH_W 308
+#define BENCH_H 440
+static uint8_t g_bench_buffer[BENCH_W * BENCH_H];
+
+static void _bench_float(const psvs_gui_font_t *font, int glyph, float scale, int x, int y) {
+    for (int yy = 0; yy < font->height * scale; yy++) {
+        uint8_t *px = &g_bench_buffer[(y + yy) * BENCH_W + x];
+        for (int xx = 0; xx < font->width * scale; xx++)
+            px[xx] = _test_glyph_px(font, glyph, scale, xx, yy) ? 1 : 0;
+    }
+}
+
+static void _bench_atlas(const uint16_t *rows, int w, int h, int x, int y) {
+    uint8_t *px = &g_bench_buffer[y * BENCH_W + x];
+    for (int yy = 0; yy < h; yy++, px += BENCH_W) {
+        uint32_t mask = rows[yy];
+        for (int xx = 0; xx < w; xx++, mask >>= 1)
+            px[xx] = 0 ^ (1 & -(mask & 1));
+    }
+}
+
+static double _bench_now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void bench_text() {
+    const psvs_gui_font_t *font = &FONT_TER_U24B;
+    uint16_t half[GUI_FONT_GLYPHS * ((GUI_FONT_H + 1) / 2)];
+    for (int c = 0; c < GUI_FONT_GLYPHS; c++)
+        psvs_blit_glyph_half(&half[c * ((font->height + 1) / 2)], &font->rows[c * font->height], font->width, font->height);
+
+    const int n = 200000;
+    for (int s = 0; s < 2; s++) {
+        float scale = s ? 1.0f : 0.5f;
+
+        double t0 = _bench_now();
+        for (int i = 0; i < n; i++)
+            _bench_float(font, i % GUI_FONT_GLYPHS, scale, (i * 12) % 280, (i / 23 * 24) % 400);
+        double t1 = _bench_now();
+        for (int i = 0; i < n; i++) {
+            int glyph = i % GUI_FONT_GLYPHS;
+            if (s)
+                _bench_atlas(&font->rows[glyph * font->height], font->width, font->height, (i * 12) % 280, (i / 23 * 24) % 400);
+            else
+                _bench_atlas(&half[glyph * ((font->height + 1) / 2)], (font->width + 1) / 2, (font->height + 1) / 2,
+                             (i * 12) % 280, (i / 23 * 24) % 400);
+        }
+        double t2 = _bench_now();
+
+        printf("%.1fx: float %.0f glyphs/s, atlas %.0f glyphs/s\n", scale, n / (t1 - t0), n / (t2 - t1));
+    }
+}
+
+int main(int argc, char **argv) {
+    test_blend();
+    test_expand();
+    test_ops();
+    test_glyph_half();
+    test_glyph_spans();
+    test_remap();
+    test_layout();
+
+    if (argc > 1 && !strcmp(argv[1], "-b"))
+        bench_text();
+
+    printf("%s\n", g_failed ? "FAILED" : "OK");
+    return g_failed ? 1 : 0;
+}
@@ -0,0 +1,299 @@
+// Host unit tests of perf.c: Q16.16 EWMA, sliding window min/max/mean,
+// 1s/5s/15s load averages, frametime histogram, frame sampling gaps and
+// unique fps of stalled or single buffered apps.
+#include <vitasdkkern.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "main.h"
+#include "perf.h"
+#include "stub.h"
+
+#define SECOND 1000000
+
+static int g_failed = 0;
+
+#define TEST_CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            printf("  FAIL %s:%d %s: ", __func__, __LINE__, #cond); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            g_failed++; \
+        } \
+    } while (0)
+
+// Expected EWMA step response from `from` to `to` after `t` of time constant `tau`
+static int _test_step(int from, int to, double t, double tau) {
+    return (int)lround(to + (from - to) * exp(-t / tau));
+}
+
+static void test_ewma() {
+    psvs_ewma_t ewma;
+
+    // First sample is taken as is
+    psvs_perf_ewma_init(&ewma, 500 * 1000, SECOND);
+    TEST_CHECK(psvs_perf_ewma_get(&ewma) == 0, "unprimed %d", psvs_perf_ewma_get(&ewma));
+    psvs_perf_ewma_add(&ewma, 42);
+    TEST_CHECK(psvs_perf_ewma_get(&ewma) == 42, "primed %d", psvs_perf_ewma_get(&ewma));
+
+    // Step response follows exp(-t / window)
+    psvs_perf_ewma_init(&ewma, 50 * 1000, SECOND);
+    psvs_perf_ewma_add(&ewma, 0);
+    for (int i = 1; i <= 100; i++) {
+        psvs_perf_ewma_add(&ewma, 10000);
+        int expected = _test_step(0, 10000, i * 0.05, 1.0);
+        int got = psvs_perf_ewma_get(&ewma);
+        TEST_CHECK(abs(got - expected) <= 10, "step %d: %d, expected %d", i, got, expected);
+    }
+
+    // Settles on the input, both directions
+    for (int i = 0; i < 400; i++)
+        psvs_perf_ewma_add(&ewma, -1234);
+    TEST_CHECK(psvs_perf_ewma_get(&ewma) == -1234, "settled %d", psvs_perf_ewma_get(&ewma));
+
+    // Period way past the window forgets the old value
+    psvs_perf_ewma_init(&ewma, 300 * SECOND, SECOND);
+    psvs_perf_ewma_add(&ewma, 100);
+    psvs_perf_ewma_add(&ewma, 7);
+    TEST_CHECK(psvs_perf_ewma_get(&ewma) == 7, "long period %d", psvs_perf_ewma_get(&ewma));
+
+    // Irregular intervals weigh by elapsed time, not by sample count
+    psvs_perf_ewma_init(&ewma, 0, 2 * SECOND);
+    psvs_perf_ewma_add(&ewma, 0);
+    uint32_t periods[] = {50000, 200000, 50000, 700000, 1000000};
+    double t = 0;
+    for (int i = 0; i < sizeof(periods) / sizeof(periods[0]); i++) {
+        psvs_perf_ewma_set_period(&ewma, periods[i], 2 * SECOND);
+        psvs_perf_ewma_add(&ewma, 10000);
+        t += periods[i] / (double)SECOND;
+        int expected = _test_step(0, 10000, t, 2.0);
+        int got = psvs_perf_ewma_get(&ewma);
+        TEST_CHECK(abs(got - expected) <= 10, "after %.2fs: %d, expected %d", t, got, expected);
+    }
+}
+
+// Against a brute force pass over the same samples
+static void test_window_size(int size) {
+    psvs_window_t window;
+    int32_t samples[1000];
+    uint32_t seed = 12345 + size;
+
+    psvs_perf_window_init(&window, size);
+    TEST_CHECK(psvs_perf_window_mean(&window) == 0, "empty mean");
+
+    for (int i = 0; i < 1000; i++) {
+        seed = seed * 1103515245 + 12345;
+        samples[i] = (int32_t)(seed >> 8) % 100000 - 50000;
+        // Runs of equal and monotonic samples stress the deques
+        if (i % 97 < 10)
+            samples[i] = 777;
+        else if (i % 89 < 20)
+            samples[i] = i * 10;
+        psvs_perf_window_add(&window, samples[i]);
+
+        int first = i + 1 > size ? i + 1 - size : 0;
+        int32_t min = samples[first], max = samples[first];
+        int64_t sum = 0;
+        for (int j = first; j <= i; j++) {
+            if (samples[j] < min)
+                min = samples[j];
+            if (samples[j] > max)
+                max = samples[j];
+            sum += samples[j];
+        }
+        int n = i + 1 - first;
+        int32_t mean = (sum + (n / 2)) / n;
+
+        TEST_CHECK(psvs_perf_window_min(&window) == min, "size %d sample %d: min %d, expected %d",
+                   size, i, psvs_perf_window_min(&window), min);
+        TEST_CHECK(psvs_perf_window_max(&window) == max, "size %d sample %d: max %d, expected %d",
+                   size, i, psvs_perf_window_max(&window), max);
+        TEST_CHECK(psvs_perf_window_mean(&window) == mean, "size %d sample %d: mean %d, expected %d",
+                   size, i, psvs_perf_window_mean(&window), mean);
+    }
+}
+
+static void test_window() {
+    test_window_size(1);
+    test_window_size(8);
+    test_window_size(10);
+    test_window_size(PSVS_WINDOW_MAX);
+}
+
+static void test_loadavg() {
+    psvs_loadavg_t loadavg;
+    const double windows[PSVS_LOADAVG_MAX] = {1.0, 5.0, 15.0};
+
+    // 500ms samples, as psvs_perf_poll_cpu takes them
+    psvs_perf_loadavg_init(&loadavg, 500 * 1000);
+    for (int i = 0; i < 10; i++)
+        psvs_perf_loadavg_add(&loadavg, 20);
+    for (int w = 0; w < PSVS_LOADAVG_MAX; w++)
+        TEST_CHECK(psvs_perf_loadavg_get(&loadavg, w) == 20, "window %d steady %d",
+                   w, psvs_perf_loadavg_get(&loadavg, w));
+
+    for (int i = 1; i <= 60; i++) {
+        psvs_perf_loadavg_add(&loadavg, 100);
+        for (int w = 0; w < PSVS_LOADAVG_MAX; w++) {
+            int expected = _test_step(20, 100, i * 0.5, windows[w]);
+            int got = psvs_perf_loadavg_get(&loadavg, w);
+            TEST_CHECK(abs(got - expected) <= 1, "window %d after %.1fs: %d, expected %d",
+                       w, i * 0.5, got, expected);
+        }
+    }
+
+    // Longer windows lag behind
+    TEST_CHECK(psvs_perf_loadavg_get(&loadavg, PSVS_LOADAVG_1S) >= psvs_perf_loadavg_get(&loadavg, PSVS_LOADAVG_5S)
+               && psvs_perf_loadavg_get(&loadavg, PSVS_LOADAVG_5S) >= psvs_perf_loadavg_get(&loadavg, PSVS_LOADAVG_15S),
+               "windows out of order");
+}
+
+static void test_hist() {
+    static psvs_frametime_hist_t hist;
+    psvs_frametime_stats_t stats;
+
+    // 990 frames at 16.7ms, 10 at 50ms
+    memset(&hist, 0, sizeof(hist));
+    for (int i = 0; i < 1000; i++)
+        psvs_perf_hist_add(&hist, i < 990 ? 16667 : 50000);
+    psvs_perf_hist_stats(&hist, 1000, &stats);
+    TEST_CHECK(stats.p50 / 256 == 16667 / 256 && stats.p99 / 256 == 16667 / 256, "p50 %u p99 %u", stats.p50, stats.p99);
+    TEST_CHECK(stats.p99_9 / 256 == 50000 / 256, "p99.9 %u", stats.p99_9);
+    TEST_CHECK(stats.low_1 == 20, "1%% low %d", stats.low_1);
+
+    // Slowest 1% sums past 32 bits
+    memset(&hist, 0, sizeof(hist));
+    hist.n[PSVS_PERF_HIST_BUCKETS - 1] = 200000;
+    hist.n[10] = 9800000;
+    psvs_perf_hist_stats(&hist, 10000000, &stats);
+    int expected = (SECOND + (PSVS_PERF_HIST_BUCKETS - 1) * 128) / ((PSVS_PERF_HIST_BUCKETS - 1) << PSVS_PERF_HIST_SHIFT);
+    TEST_CHECK(stats.low_1 == expected, "1%% low %d, expected %d", stats.low_1, expected);
+}
+
+// Presents `n` frames, each `vblanks` long, flipping between two fbs
+static void _test_frames(int n, int vblanks) {
+    static int fb = 0;
+    for (int i = 0; i < n; i++) {
+        g_stub_time += vblanks * 16667;
+        g_stub_vcount += vblanks;
+        fb ^= 1;
+        psvs_perf_calc_fps(0, (const void *)(uintptr_t)(0x1000 + fb));
+    }
+}
+
+static void test_frame_gap() {
+    psvs_stutter_t stutter;
+    psvs_perf_init();
+
+    // Vcount and tick start far from 0, first frame must not be a hitch
+    g_stub_time = 100 * SECOND;
+    g_stub_vcount = 6000;
+    _test_frames(120, 2);
+    psvs_perf_get_stutter(&stutter);
+    TEST_CHECK(stutter.hitches == 0, "%u hitches on start", stutter.hitches);
+    TEST_CHECK(psvs_perf_get_frame_count() == 119, "%u frames, first one only seeds", psvs_perf_get_frame_count());
+    TEST_CHECK(psvs_perf_get_fps() == 30, "fps %d", psvs_perf_get_fps());
+
+    // Frames unseen while hidden
+    psvs_perf_frame_gap();
+    g_stub_time += 10 * SECOND;
+    g_stub_vcount += 600;
+    _test_frames(60, 2);
+    psvs_perf_get_stutter(&stutter);
+    TEST_CHECK(stutter.hitches == 0, "%u hitches after a gap", stutter.hitches);
+    TEST_CHECK(psvs_perf_get_frametime(psvs_perf_get_frame_count() - 60) < 40000,
+               "gap in frametimes: %u us", psvs_perf_get_frametime(psvs_perf_get_frame_count() - 60));
+    TEST_CHECK(psvs_perf_get_fps() == 30, "fps %d", psvs_perf_get_fps());
+
+    // Real hitches still count
+    _test_frames(1, 6);
+    _test_frames(10, 2);
+    psvs_perf_get_stutter(&stutter);
+    TEST_CHECK(stutter.hitches == 1, "%u hitches, expected 1", stutter.hitches);
+}
+
+// First poll only takes the since-boot counters
+static void test_cpu_rates() {
+    memset(&g_stub_sysinfo, 0, sizeof(g_stub_sysinfo));
+    g_stub_sysinfo.cpuInfo[0].comesOutOfIdleCount = 123456789;
+    g_stub_sysinfo.cpuInfo[0].threadSwitchCount = 987654321;
+    g_stub_time = 1000 * SECOND;
+    psvs_perf_poll_cpu();
+    TEST_CHECK(psvs_perf_get_wakeups(0) == 0 && psvs_perf_get_switches(0) == 0,
+               "first poll %d wk %d sw", psvs_perf_get_wakeups(0), psvs_perf_get_switches(0));
+
+    g_stub_sysinfo.cpuInfo[0].comesOutOfIdleCount += 100;
+    g_stub_sysinfo.cpuInfo[0].threadSwitchCount += 500;
+    g_stub_time += SECOND / 2;
+    psvs_perf_poll_cpu();
+    TEST_CHECK(psvs_perf_get_wakeups(0) == 200 && psvs_perf_get_switches(0) == 1000,
+               "%d wk %d sw, expected 200 1000", psvs_perf_get_wakeups(0), psvs_perf_get_switches(0));
+}
+
+// Presents the same fb `n` times, each `vblanks` long
+static void _test_represents(int n, int vblanks) {
+    for (int i = 0; i < n; i++) {
+        g_stub_time += vblanks * 16667;
+        g_stub_vcount += vblanks;
+        psvs_perf_calc_fps(0, (const void *)0x2000);
+    }
+}
+
+static void test_fps_static() {
+    psvs_perf_init();
+    psvs_perf_frame_gap();
+    _test_frames(60, 2);
+    TEST_CHECK(psvs_perf_get_fps() == 30, "fps %d", psvs_perf_get_fps());
+
+    // Stalled on one fb, unique fps drops instead of freezing
+    _test_represents(60, 1);
+    TEST_CHECK(psvs_perf_get_fps() == 0, "stalled fps %d", psvs_perf_get_fps());
+    TEST_CHECK(psvs_perf_get_present_fps() == 60, "stalled present fps %d", psvs_perf_get_present_fps());
+
+    // Same fb for long, single buffered: falls back to the present rate
+    _test_represents(120, 1);
+    TEST_CHECK(psvs_perf_get_fps() == 60, "single buffered fps %d", psvs_perf_get_fps());
+
+    // Flipping again
+    _test_frames(60, 2);
+    TEST_CHECK(psvs_perf_get_fps() == 30, "resumed fps %d", psvs_perf_get_fps());
+}
+
+// Temp smoothing has the same time constant whatever the poll rate
+static int _test_batt_temp(uint32_t tick) {
+    psvs_perf_init();
+    g_stub_batt_temp = 3000;
+    psvs_perf_poll_batt();
+    g_stub_batt_temp = 4000;
+    for (uint32_t t = 0; t < 2 * SECOND; t += tick) {
+        g_stub_time += tick;
+        psvs_perf_poll_batt();
+    }
+    return psvs_perf_get_batt()->temp;
+}
+
+static void test_batt_temp() {
+    int expected = _test_step(3000, 4000, 2.0, 2.0) / 100;
+    uint32_t ticks[] = {50 * 1000, 200 * 1000, 500 * 1000};
+    for (int i = 0; i < sizeof(ticks) / sizeof(ticks[0]); i++) {
+        int temp = _test_batt_temp(ticks[i]);
+        TEST_CHECK(temp == expected, "%uus polls: %d C, expected %d C", ticks[i], temp, expected);
+    }
+}
+
+int main(int argc, char **argv) {
+    test_ewma();
+    test_window();
+    test_loadavg();
+    test_hist();
+    test_cpu_rates();
+    test_frame_gap();
+    test_fps_static();
+    test_batt_temp();
+
+    printf("%s\n", g_failed ? "FAILED" : "OK");
+    return g_failed ? 1 : 0;
+}
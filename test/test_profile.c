@@ -0,0 +1,314 @@
+// Host tests of profile.c on the stub filesystem: profiles.db round trip,
+// upgrade of PSVS0110 entries, per-title and official file migration,
+// corrupt/truncated db moved to .bad, .bak recovery and a full table.
+#include <vitasdkkern.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+
+#include "main.h"
+#include "oc.h"
+#include "profile.h"
+#include "stub.h"
+
+static int g_failed = 0;
+
+#define TEST_CHECK(cond, ...) do { \
+        if (!(cond)) { \
+            printf("  FAIL %s:%d %s: ", __func__, __LINE__, #cond); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+            g_failed++; \
+        } \
+    } while (0)
+
+// Fake ScePower, psvs_profile_load() applies clocks
+static int g_test_freq[PSVS_OC_DEVICE_MAX] = {333, 111, 222, 111, 166};
+
+static int _test_get_cpu() { return g_test_freq[PSVS_OC_DEVICE_CPU]; }
+static int _test_get_bus() { return g_test_freq[PSVS_OC_DEVICE_BUS]; }
+static int _test_get_xbar() { return g_test_freq[PSVS_OC_DEVICE_GPU_XBAR]; }
+static int _test_get_vnz() { return g_test_freq[PSVS_OC_DEVICE_VENEZIA]; }
+static int _test_get_es4(int *a1, int *a2) {
+    *a1 = *a2 = g_test_freq[PSVS_OC_DEVICE_GPU_ES4];
+    return 0;
+}
+static int _test_set_cpu(int freq) { g_test_freq[PSVS_OC_DEVICE_CPU] = freq; return 0; }
+static int _test_set_bus(int freq) { g_test_freq[PSVS_OC_DEVICE_BUS] = freq; return 0; }
+static int _test_set_xbar(int freq) { g_test_freq[PSVS_OC_DEVICE_GPU_XBAR] = freq; return 0; }
+static int _test_set_vnz(int freq) { g_test_freq[PSVS_OC_DEVICE_VENEZIA] = freq; return 0; }
+static int _test_set_es4(int a1, int a2) { g_test_freq[PSVS_OC_DEVICE_GPU_ES4] = a1; return 0; }
+
+// Official PSVshell per-title file, PSVS0100
+typedef struct {
+    char ver[8];
+    psvs_oc_mode_t mode[PSVS_OC_DEVICE_VENEZIA];
+    int manual_freq[PSVS_OC_DEVICE_VENEZIA];
+} test_compat_profile_t;
+
+static void _test_profile(psvs_oc_profile_t *oc, const char *ver, int cpu, int target_fps) {
+    memset(oc, 0, sizeof(psvs_oc_profile_t));
+    memcpy(oc->ver, ver, 8);
+    oc->mode[PSVS_OC_DEVICE_CPU] = PSVS_OC_MODE_MANUAL;
+    oc->manual_freq[PSVS_OC_DEVICE_CPU] = cpu;
+    oc->target_fps = target_fps;
+}
+
+// Saves the oc profile under titleid, or as the global one
+static bool _test_save(const char *titleid, int cpu, int target_fps) {
+    _test_profile(psvs_oc_get_profile(), PSVS_VERSION_VER, cpu, target_fps);
+    strcpy(g_titleid, titleid ? titleid : "");
+    return psvs_profile_save(titleid == NULL);
+}
+
+// Loads titleid's profile, returns its manual CPU clock or 0
+static int _test_load(const char *titleid, int *target_fps) {
+    psvs_oc_init();
+    strcpy(g_titleid, titleid);
+    if (!psvs_profile_load(NULL))
+        return 0;
+    if (target_fps)
+        *target_fps = psvs_oc_get_profile()->target_fps;
+    return psvs_oc_get_profile()->manual_freq[PSVS_OC_DEVICE_CPU];
+}
+
+static void _test_put_db(const char *path, const psvs_profile_entry_t *entries, int entry_n,
+                         int entry_size, int header_n) {
+    static uint8_t buf[sizeof(psvs_profile_db_header_t) + 4 * sizeof(psvs_profile_entry_t)];
+    psvs_profile_db_header_t *header = (psvs_profile_db_header_t *)buf;
+    memset(buf, 0, sizeof(buf));
+    memcpy(header->magic, PSVS_PROFILE_DB_MAGIC, sizeof(header->magic));
+    header->version = PSVS_PROFILE_DB_VERSION;
+    header->entry_size = entry_size;
+    header->entry_n = header_n;
+
+    int size = sizeof(psvs_profile_db_header_t);
+    for (int i = 0; i < entry_n; i++, size += entry_size)
+        memcpy(buf + size, &entries[i], entry_size);
+    stub_fs_put(path, buf, size);
+}
+
+// Entry count in the db file, -1 if missing or not a db
+static int _test_db_entry_n(const char *path) {
+    psvs_profile_db_header_t header;
+    if (stub_fs_get(path, &header, sizeof(header)) < (int)sizeof(header)
+            || memcmp(header.magic, PSVS_PROFILE_DB_MAGIC, sizeof(header.magic)))
+        return -1;
+    return header.entry_n;
+}
+
+static void test_round_trip() {
+    stub_fs_reset();
+    psvs_profile_init();
+    TEST_CHECK(_test_save("PCSB00001", 444, 45), "title save");
+    TEST_CHECK(_test_save(NULL, 222, 30), "global save");
+    psvs_profile_deinit();
+
+    TEST_CHECK(stub_fs_get(PSVS_PROFILE_DB, NULL, 0)
+               == sizeof(psvs_profile_db_header_t) + 2 * sizeof(psvs_profile_entry_t),
+               "db size %d", stub_fs_get(PSVS_PROFILE_DB, NULL, 0));
+    TEST_CHECK(stub_fs_get(PSVS_PROFILE_DB ".tmp", NULL, 0) < 0, ".tmp left behind");
+
+    psvs_profile_init();
+    int target_fps = 0;
+    int cpu = _test_load("PCSB00001", &target_fps);
+    TEST_CHECK(cpu == 444 && target_fps == 45, "title profile %d@%d", cpu, target_fps);
+    TEST_CHECK(g_test_freq[PSVS_OC_DEVICE_CPU] == 444, "clock not applied %d", g_test_freq[PSVS_OC_DEVICE_CPU]);
+    cpu = _test_load("PCSB99999", NULL);
+    TEST_CHECK(cpu == 222, "global fallback %d", cpu);
+
+    // Deleted profile falls back to global on next start
+    strcpy(g_titleid, "PCSB00001");
+    TEST_CHECK(psvs_profile_delete(false), "delete");
+    TEST_CHECK(!psvs_profile_exists(false), "exists after delete");
+    psvs_profile_deinit();
+
+    psvs_profile_init();
+    cpu = _test_load("PCSB00001", NULL);
+    TEST_CHECK(cpu == 222, "deleted profile %d", cpu);
+    TEST_CHECK(stub_fs_get(PSVS_PROFILE_DB ".bak", NULL, 0) > 0, "no .bak of previous db");
+    psvs_profile_deinit();
+}
+
+static void test_upgrade() {
+    psvs_profile_entry_t entries[2];
+    memset(entries, 0, sizeof(entries));
+    strcpy(entries[0].titleid, "PCSB00002");
+    _test_profile(&entries[0].profile, "PSVS0110", 444, 0);
+    strcpy(entries[1].titleid, "PCSB00003");
+    _test_profile(&entries[1].profile, "PSVS9999", 500, 0); // unknown, kept as is
+
+    // PSVS0110 db entries end before target_fps
+    stub_fs_reset();
+    _test_put_db(PSVS_PROFILE_DB, entries, 2, offsetof(psvs_profile_entry_t, profile.target_fps), 2);
+    psvs_profile_init();
+    int target_fps = 0;
+    int cpu = _test_load("PCSB00002", &target_fps);
+    TEST_CHECK(cpu == 444 && target_fps == PSVS_OC_TARGET_FPS_DEFAULT, "upgraded %d@%d", cpu, target_fps);
+    TEST_CHECK(!strncmp(psvs_oc_get_profile()->ver, PSVS_VERSION_VER, 8), "version not bumped");
+    cpu = _test_load("PCSB00003", NULL);
+    TEST_CHECK(cpu == 0, "unknown version loaded %d", cpu);
+    strcpy(g_titleid, "PCSB00003");
+    TEST_CHECK(psvs_profile_exists(false), "unknown version dropped");
+    psvs_profile_deinit();
+    TEST_CHECK(stub_fs_get(PSVS_PROFILE_DB ".bad", NULL, 0) < 0, "old db moved to .bad");
+}
+
+static void test_migrate() {
+    psvs_oc_profile_t oc;
+    test_compat_profile_t compat;
+
+    stub_fs_reset();
+    _test_profile(&oc, "PSVS0110", 444, 0);
+    stub_fs_put(PSVS_PROFILES_DIR "PCSB00004", &oc, offsetof(psvs_oc_profile_t, target_fps));
+    _test_profile(&oc, PSVS_VERSION_VER, 333, 50);
+    stub_fs_put(PSVS_PROFILES_DIR "PCSB00005", &oc, sizeof(oc));
+
+    // Official ones only fill in titles we have no file for
+    memset(&compat, 0, sizeof(compat));
+    memcpy(compat.ver, "PSVS0100", 8);
+    compat.mode[PSVS_OC_DEVICE_CPU] = PSVS_OC_MODE_MANUAL;
+    compat.manual_freq[PSVS_OC_DEVICE_CPU] = 500;
+    stub_fs_put(PSVS_COMPAT_PROFILES_DIR "PCSB00004", &compat, sizeof(compat));
+    stub_fs_put(PSVS_COMPAT_PROFILES_DIR "PCSB00006", &compat, sizeof(compat));
+    stub_fs_put(PSVS_COMPAT_PROFILES_DIR "PCSB00007", &compat, sizeof(compat) - 4); // truncated
+
+    psvs_profile_init();
+    int target_fps = 0;
+    int cpu = _test_load("PCSB00004", &target_fps);
+    TEST_CHECK(cpu == 444 && target_fps == PSVS_OC_TARGET_FPS_DEFAULT, "PSVS0110 file %d@%d", cpu, target_fps);
+    cpu = _test_load("PCSB00005", &target_fps);
+    TEST_CHECK(cpu == 333 && target_fps == 50, "current file %d@%d", cpu, target_fps);
+    cpu = _test_load("PCSB00006", &target_fps);
+    TEST_CHECK(cpu == 500 && target_fps == PSVS_OC_TARGET_FPS_DEFAULT, "compat file %d@%d", cpu, target_fps);
+    TEST_CHECK(psvs_oc_get_profile()->mode[PSVS_OC_DEVICE_VENEZIA] == PSVS_OC_MODE_DEFAULT, "compat venezia mode");
+    cpu = _test_load("PCSB00007", NULL);
+    TEST_CHECK(cpu == 0, "truncated compat file loaded %d", cpu);
+    psvs_profile_deinit();
+
+    TEST_CHECK(_test_db_entry_n(PSVS_PROFILE_DB) == 3, "migrated %d", _test_db_entry_n(PSVS_PROFILE_DB));
+}
+
+static void test_bad() {
+    static const char garbage[] = "not a profile db at all";
+    psvs_profile_entry_t entry;
+
+    // Wrong magic
+    stub_fs_reset();
+    stub_fs_put(PSVS_PROFILE_DB, garbage, sizeof(garbage));
+    psvs_profile_init();
+    TEST_CHECK(_test_save("PCSB00008", 444, 30), "save after bad db");
+    psvs_profile_deinit();
+    TEST_CHECK(stub_fs_get(PSVS_PROFILE_DB ".bad", NULL, 0) == sizeof(garbage), "bad db not kept");
+    TEST_CHECK(_test_db_entry_n(PSVS_PROFILE_DB) == 1, "new db %d", _test_db_entry_n(PSVS_PROFILE_DB));
+
+    // Header cut short
+    stub_fs_reset();
+    memset(&entry, 0, sizeof(entry));
+    _test_put_db(PSVS_PROFILE_DB, &entry, 0, sizeof(entry), 0);
+    uint8_t buf[sizeof(psvs_profile_db_header_t)];
+    stub_fs_get(PSVS_PROFILE_DB, buf, sizeof(buf));
+    stub_fs_put(PSVS_PROFILE_DB, buf, sizeof(buf) - 1);
+    psvs_profile_init();
+    psvs_profile_deinit();
+    TEST_CHECK(stub_fs_get(PSVS_PROFILE_DB ".bad", NULL, 0) == sizeof(buf) - 1, "short header not moved");
+    TEST_CHECK(_test_db_entry_n(PSVS_PROFILE_DB) == 0, "db not rewritten %d", _test_db_entry_n(PSVS_PROFILE_DB));
+
+    // Entry size from a future layout
+    stub_fs_reset();
+    _test_put_db(PSVS_PROFILE_DB, &entry, 0, sizeof(entry) + 4, 0);
+    psvs_profile_init();
+    psvs_profile_deinit();
+    TEST_CHECK(stub_fs_get(PSVS_PROFILE_DB ".bad", NULL, 0) > 0, "future entry size not moved");
+
+    // Fewer entries than the header says, the ones there are kept
+    stub_fs_reset();
+    strcpy(entry.titleid, "PCSB00009");
+    _test_profile(&entry.profile, PSVS_VERSION_VER, 444, 30);
+    _test_put_db(PSVS_PROFILE_DB, &entry, 1, sizeof(entry), 3);
+    psvs_profile_init();
+    int cpu = _test_load("PCSB00009", NULL);
+    TEST_CHECK(cpu == 444, "entry of truncated db %d", cpu);
+    psvs_profile_deinit();
+    TEST_CHECK(stub_fs_get(PSVS_PROFILE_DB ".bad", NULL, 0) < 0, "truncated db moved to .bad");
+}
+
+// Swap interrupted after the db went to .bak
+static void test_bak() {
+    psvs_profile_entry_t entry;
+    memset(&entry, 0, sizeof(entry));
+    strcpy(entry.titleid, "PCSB00010");
+    _test_profile(&entry.profile, PSVS_VERSION_VER, 444, 30);
+
+    stub_fs_reset();
+    _test_put_db(PSVS_PROFILE_DB ".bak", &entry, 1, sizeof(entry), 1);
+    stub_fs_put(PSVS_PROFILE_DB ".tmp", "x", 1);
+    psvs_profile_init();
+    int cpu = _test_load("PCSB00010", NULL);
+    TEST_CHECK(cpu == 444, "profile from .bak %d", cpu);
+    psvs_profile_deinit();
+    TEST_CHECK(_test_db_entry_n(PSVS_PROFILE_DB) == 1, "db not restored %d", _test_db_entry_n(PSVS_PROFILE_DB));
+}
+
+static void test_full() {
+    char titleid[PSVS_PROFILE_TITLEID_LEN];
+
+    stub_fs_reset();
+    psvs_profile_init();
+    for (int i = 0; i < PSVS_PROFILE_DB_MAX; i++) {
+        snprintf(titleid, sizeof(titleid), "PCSA%05d", i);
+        TEST_CHECK(_test_save(titleid, 444, 30), "save %d", i);
+    }
+    TEST_CHECK(!_test_save("PCSB99999", 444, 30), "save past PSVS_PROFILE_DB_MAX");
+    TEST_CHECK(_test_save("PCSA00007", 333, 30), "update in full table");
+
+    // Open addressing lookup finds every entry
+    for (int i = 0; i < PSVS_PROFILE_DB_MAX; i++) {
+        snprintf(g_titleid, sizeof(g_titleid), "PCSA%05d", i);
+        TEST_CHECK(psvs_profile_exists(false), "%s lost", g_titleid);
+    }
+    strcpy(g_titleid, "PCSB99999");
+    TEST_CHECK(!psvs_profile_exists(false), "%s exists", g_titleid);
+
+    // Delete frees a slot
+    strcpy(g_titleid, "PCSA00000");
+    TEST_CHECK(psvs_profile_delete(false), "delete");
+    TEST_CHECK(_test_save("PCSB99999", 444, 30), "save after delete");
+    psvs_profile_deinit();
+    TEST_CHECK(_test_db_entry_n(PSVS_PROFILE_DB) == PSVS_PROFILE_DB_MAX, "%d entries", _test_db_entry_n(PSVS_PROFILE_DB));
+
+    psvs_profile_init();
+    int cpu = _test_load("PCSA00007", NULL);
+    TEST_CHECK(cpu == 333, "reloaded %d", cpu);
+    for (int i = 1; i < PSVS_PROFILE_DB_MAX; i++) {
+        snprintf(g_titleid, sizeof(g_titleid), "PCSA%05d", i);
+        TEST_CHECK(psvs_profile_exists(false), "%s lost on reload", g_titleid);
+    }
+    psvs_profile_deinit();
+}
+
+int main(int argc, char **argv) {
+    _kscePowerGetArmClockFrequency = _test_get_cpu;
+    _kscePowerGetBusClockFrequency = _test_get_bus;
+    _kscePowerGetGpuEs4ClockFrequency = _test_get_es4;
+    _kscePowerGetGpuXbarClockFrequency = _test_get_xbar;
+    _kscePowerGetVeneziaClockFrequencyForDriver = _test_get_vnz;
+    _kscePowerSetArmClockFrequency = _test_set_cpu;
+    _kscePowerSetBusClockFrequency = _test_set_bus;
+    _kscePowerSetGpuEs4ClockFrequency = _test_set_es4;
+    _kscePowerSetGpuXbarClockFrequency = _test_set_xbar;
+    _kscePowerSetVeneziaClockFrequencyForDriver = _test_set_vnz;
+    psvs_oc_setup();
+
+    test_round_trip();
+    test_upgrade();
+    test_migrate();
+    test_bad();
+    test_bak();
+    test_full();
+
+    psvs_oc_teardown();
+    printf("%s\n", g_failed ? "FAILED" : "OK");
+    return g_failed ? 1 : 0;
+}
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+#
+# Generates src/gui_font.h - subset of the Terminus fonts used by the GUI.
+#
+# Only printable ASCII is kept, everything the GUI prints (format strings,
+# title ids, profile values) falls in that range. Glyph rows are stored in
+# the order the renderer reads them: one 16-bit mask per row, bit n set
+# => px at column n. Other chars are remapped to '?'.
+#
+# Usage: tools/gen_gui_font.py > src/gui_font.h
+
+import os
+import re
+import sys
+
+FONTS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "fonts")
+
+GLYPH_FIRST = 0x20
+GLYPH_LAST = 0x7E
+GLYPH_FALLBACK = "?"
+
+# (source, name, source width, width, height)
+FONTS = [
+    ("ter-u14b.h", "FONT_TER_U14B", 8, 8, 14),   # Terminus 8x14 Bold
+    ("ter-u18b.h", "FONT_TER_U18B", 10, 9, 18),  # Terminus 10x18 Bold, last col trimmed
+    ("ter-u24b.h", "FONT_TER_U24B", 12, 12, 24), # Terminus 12x24 Bold
+]
+
+
+def load(path):
+    with open(path) as f:
+        text = f.read()
+    body = text[text.index("{") + 1:text.rindex("}")]
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    return [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+
+
+def glyph_rows(data, c, src_width, width, height):
+    pitch = (src_width + 7) // 8
+    glyph = data[c * height * pitch:(c + 1) * height * pitch]
+    rows = []
+    for yy in range(height):
+        row = glyph[yy * pitch:(yy + 1) * pitch]
+        mask = 0
+        for xx in range(width):
+            if (row[xx // 8] >> (7 - (xx % 8))) & 1:
+                mask |= 1 << xx
+        rows.append(mask)
+    return rows
+
+
+def array(values, fmt, indent=4, per_line=12):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(" " * indent + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    glyphs = list(range(GLYPH_FIRST, GLYPH_LAST + 1))
+    fallback = glyphs.index(ord(GLYPH_FALLBACK))
+    remap = [glyphs.index(c) if c in glyphs else fallback for c in range(256)]
+
+    out = []
+    out.append("""/*
+ * Generated by tools/gen_gui_font.py, do not edit.
+ *
+ * Copyright (c) 2018 Dimitar Toshkov Zhekov,
+ * with Reserved Font Name "Terminus Font".
+ *
+ * This Font Software is licensed under the SIL Open Font License, Version 1.1.
+ * This license is available with a FAQ at http://scripts.sil.org/OFL
+ *
+ * Version 4.47
+ */
+
+typedef struct {
+    unsigned char width;
+    unsigned char height;
+    const unsigned short *rows; // [GUI_FONT_GLYPHS][height], bit n set => px at column n
+} psvs_gui_font_t;
+
+#define GUI_FONT_GLYPHS %d
+
+// char -> glyph index
+static const unsigned char GUI_FONT_REMAP[256] = {
+%s
+};""" % (len(glyphs), array(remap, "%d", per_line=16)))
+
+    size_before = 0
+    size_after = 256
+    for (source, name, src_width, width, height) in FONTS:
+        data = load(os.path.join(FONTS_DIR, source))
+        assert len(data) == 256 * height * ((src_width + 7) // 8), source
+        size_before += len(data)
+
+        out.append("")
+        out.append("static const unsigned short %s_ROWS[GUI_FONT_GLYPHS * %d] = {" % (name, height))
+        for c in glyphs:
+            rows = glyph_rows(data, c, src_width, width, height)
+            size_after += len(rows) * 2
+            out.append("    // %r" % chr(c))
+            out.append(array(rows, "0x%04x"))
+        out.append("};")
+        out.append("static const psvs_gui_font_t %s = {" % name)
+        out.append("    .width = %d, .height = %d, .rows = %s_ROWS" % (width, height, name))
+        out.append("};")
+
+    print("\n".join(out))
+    sys.stderr.write("font data: %d -> %d bytes\n" % (size_before, size_after))
+
+
+if __name__ == "__main__":
+    main()
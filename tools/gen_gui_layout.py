@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+#
+# Generates src/gui_layout.h - per-resolution GUI layout tables.
+#
+# Mirrors the float math the GUI used to do at runtime, so the tables
+# match the previous output pixel for pixel.
+#
+# Usage: tools/gen_gui_layout.py > src/gui_layout.h
+
+import struct
+
+GUI_WIDTH = 308
+GUI_HEIGHT = 440
+GUI_OSD_HEIGHT = 116
+
+GUI_CORNERS_XD = [9, 7, 5, 4, 3, 2, 2, 1, 1]
+
+# (fb width, fb height, font), fonts are in gui_font.h
+RESOLUTIONS = [
+    (640, 368, "FONT_TER_U14B"),
+    (720, 408, "FONT_TER_U18B"),
+    (960, 544, "FONT_TER_U24B"),
+]
+
+
+def f32(v):
+    return struct.unpack("f", struct.pack("f", v))[0]
+
+
+def rescale(v, ratio):
+    # (int)((v) * (ratio > 1.0f ? 1.0f : ratio))
+    return int(f32(f32(v) * min(ratio, 1.0)))
+
+
+def corners(fb_height, height, rows, ratio_w):
+    xd = []
+    for line in range(rows):
+        xd_line = line
+        if fb_height < 544:
+            xd_line = int(f32(f32(xd_line) * f32(544.0 / fb_height)))
+        if xd_line < len(GUI_CORNERS_XD):
+            xd.append(rescale(GUI_CORNERS_XD[xd_line], ratio_w))
+        elif xd_line >= height - len(GUI_CORNERS_XD):
+            xd.append(rescale(GUI_CORNERS_XD[height - xd_line - 1], ratio_w))
+        else:
+            xd.append(0)
+    return xd
+
+
+def array(values, indent=8, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(" " * indent + ", ".join("%d" % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = []
+    out.append("""/*
+ * Generated by tools/gen_gui_layout.py, do not edit.
+ */
+
+_Static_assert(GUI_WIDTH == %d && GUI_HEIGHT == %d && GUI_OSD_HEIGHT == %d,
+               "gui_layout.h is out of date, re-run tools/gen_gui_layout.py");
+
+typedef struct {
+    unsigned int width;   // fb resolution
+    unsigned int height;
+    const psvs_gui_font_t *font;
+    unsigned short rescale_x[GUI_WIDTH + 1];  // GUI coords -> fb coords
+    unsigned short rescale_y[GUI_HEIGHT + 1];
+    unsigned short full_w, full_h;            // panel size on fb
+    unsigned short osd_w, osd_h;
+    unsigned char full_xd[GUI_HEIGHT];        // rounded corner clip per panel row
+    unsigned char osd_xd[GUI_OSD_HEIGHT];
+} psvs_gui_layout_t;
+
+#define GUI_LAYOUTS_N %d
+static const psvs_gui_layout_t GUI_LAYOUTS[GUI_LAYOUTS_N] = {""" % (GUI_WIDTH, GUI_HEIGHT, GUI_OSD_HEIGHT, len(RESOLUTIONS)))
+
+    for (width, height, font) in RESOLUTIONS:
+        ratio_w = f32(f32(width) / f32(960.0))
+        ratio_h = f32(f32(height) / f32(544.0))
+        full_h = rescale(GUI_HEIGHT, ratio_h)
+        osd_h = rescale(GUI_OSD_HEIGHT, ratio_h)
+
+        out.append("    { // %dx%d" % (width, height))
+        out.append("        .width = %d, .height = %d," % (width, height))
+        out.append("        .font = &%s," % font)
+        out.append("        .rescale_x = {")
+        out.append(array([rescale(x, ratio_w) for x in range(GUI_WIDTH + 1)], 12))
+        out.append("        },")
+        out.append("        .rescale_y = {")
+        out.append(array([rescale(y, ratio_h) for y in range(GUI_HEIGHT + 1)], 12))
+        out.append("        },")
+        out.append("        .full_w = %d, .full_h = %d," % (rescale(GUI_WIDTH, ratio_w), full_h))
+        out.append("        .osd_w = %d, .osd_h = %d," % (rescale(GUI_WIDTH, ratio_w), osd_h))
+        out.append("        .full_xd = {")
+        out.append(array(corners(height, GUI_HEIGHT, full_h, ratio_w), 12))
+        out.append("        },")
+        out.append("        .osd_xd = {")
+        out.append(array(corners(height, GUI_OSD_HEIGHT, osd_h, ratio_w), 12))
+        out.append("        },")
+        out.append("    },")
+
+    out.append("};")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+#
+# Decodes PSVshell capture files (ur0:data/PSVshell_fork/captures/*.psvscap).
+#
+# Writes one CSV row per frame and prints summary stats to stderr.
+# Format is described in src/capture.h.
+#
+# Usage: tools/psvs_capture.py FILE [-o out.csv] [--summary-only]
+
+import argparse
+import csv
+import struct
+import sys
+
+MAGIC = b"PSVSCAP\0"
+VERSION = 1
+
+HEADER = struct.Struct("<8sHHHH16sII")
+RECORD = struct.Struct("<II4B5HbB")
+
+DEVICES = ["cpu", "gpu_es4", "bus", "gpu_xbar", "venezia"]
+COLUMNS = (["frame", "timestamp_us", "frametime_us"]
+           + ["load%d" % i for i in range(4)]
+           + ["%s_mhz" % d for d in DEVICES]
+           + ["batt_temp_c", "batt_percent"])
+
+
+def read_capture(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < HEADER.size:
+        raise ValueError("file too short")
+    magic, version, header_size, record_size, _, titleid, record_n, dropped_n = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        raise ValueError("not a PSVshell capture")
+    if version != VERSION:
+        raise ValueError("unsupported version %d, expected %d" % (version, VERSION))
+    if record_size != RECORD.size:
+        raise ValueError("unexpected record size %d" % record_size)
+
+    header = {
+        "titleid": titleid.split(b"\0", 1)[0].decode("ascii", "replace"),
+        "record_n": record_n, # 0 if capture was not stopped cleanly
+        "dropped_n": dropped_n,
+    }
+
+    records = []
+    for off in range(header_size, len(data) - record_size + 1, record_size):
+        records.append(RECORD.unpack_from(data, off))
+    return header, records
+
+
+def percentile(values, p):
+    if not values:
+        return 0
+    values = sorted(values)
+    rank = max(0, min(len(values) - 1, -(-len(values) * p // 100) - 1))
+    return values[int(rank)]
+
+
+def summary(header, records, out):
+    frametimes = [r[1] for r in records]
+    n = len(records)
+    out.write("title:      %s\n" % header["titleid"])
+    out.write("frames:     %d (header %d, dropped %d)\n" % (n, header["record_n"], header["dropped_n"]))
+    if not n:
+        return
+
+    duration = (records[-1][0] - records[0][0]) & 0xFFFFFFFF
+    total = sum(frametimes[1:])
+    out.write("duration:   %.1f s\n" % (duration / 1e6))
+    if total:
+        out.write("avg fps:    %.1f\n" % ((n - 1) * 1e6 / total))
+
+    slowest = sorted(frametimes, reverse=True)[:max(1, n // 100)]
+    out.write("frametime:  p50 %.2f ms, p99 %.2f ms, p99.9 %.2f ms, max %.2f ms\n" % (
+        percentile(frametimes, 50) / 1000, percentile(frametimes, 99) / 1000,
+        percentile(frametimes, 99.9) / 1000, max(frametimes) / 1000))
+    slowest_total = sum(slowest)
+    if slowest_total:
+        out.write("1%% low:     %.1f fps\n" % (1e6 * len(slowest) / slowest_total))
+
+    for i in range(4):
+        load = [r[2 + i] for r in records]
+        out.write("core %d:     avg %d%%, max %d%%\n" % (i, sum(load) // n, max(load)))
+
+    for i, dev in enumerate(DEVICES):
+        freqs = sorted(set(r[6 + i] for r in records))
+        out.write("%-11s %s MHz\n" % (dev + ":", ", ".join(str(f) for f in freqs)))
+
+    temps = [r[11] for r in records]
+    out.write("batt temp:  %d..%d C\n" % (min(temps), max(temps)))
+    out.write("batt:       %d%% -> %d%%\n" % (records[0][12], records[-1][12]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode PSVshell capture to CSV")
+    parser.add_argument("file")
+    parser.add_argument("-o", "--output", help="CSV output, default stdout")
+    parser.add_argument("--summary-only", action="store_true", help="skip CSV output")
+    args = parser.parse_args()
+
+    try:
+        header, records = read_capture(args.file)
+    except (OSError, ValueError) as e:
+        sys.stderr.write("%s: %s\n" % (args.file, e))
+        return 1
+
+    if not args.summary_only:
+        out = open(args.output, "w", newline="") if args.output else sys.stdout
+        writer = csv.writer(out)
+        writer.writerow(COLUMNS)
+        for i, r in enumerate(records):
+            writer.writerow((i,) + r)
+        if args.output:
+            out.close()
+
+    summary(header, records, sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())